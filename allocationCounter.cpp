@@ -0,0 +1,79 @@
+/***********************************************************************
+ * Source File:
+ *    ALLOCATION COUNTER
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Count the heap allocations made while a fixture is alive
+ ************************************************************************/
+
+#include "allocationCounter.h"
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+// one count per thread so each test sees only its own allocations
+static thread_local long long numAllocations = 0;
+
+/***********************************************
+ * ALLOCATION COUNTER : GET TOTAL
+ ***********************************************/
+long long AllocationCounter::getTotal()
+{
+   return numAllocations;
+}
+
+/***********************************************
+ * ALLOCATE
+ * Count one allocation and take it from malloc
+ ***********************************************/
+static void* allocate(std::size_t size)
+{
+   numAllocations++;
+   void* p = std::malloc(size ? size : 1);
+   if (!p)
+      throw std::bad_alloc();
+   return p;
+}
+
+/***********************************************
+ * ALLOCATE ALIGNED
+ * Over-aligned types. aligned_alloc needs a multiple of the
+ * alignment and cannot be freed on Windows, so keep the
+ * malloc pointer just below the aligned block instead.
+ ***********************************************/
+static void* allocateAligned(std::size_t size, std::align_val_t align)
+{
+   std::size_t alignment = (std::size_t)align;
+   char* pRaw = (char*)allocate(size + alignment + sizeof(void*));
+   std::uintptr_t aligned = ((std::uintptr_t)(pRaw + sizeof(void*)) + alignment - 1)
+                            & ~(std::uintptr_t)(alignment - 1);
+   ((void**)aligned)[-1] = pRaw;
+   return (void*)aligned;
+}
+
+static void freeAligned(void* p)
+{
+   if (p)
+      std::free(((void**)p)[-1]);
+}
+
+/***********************************************
+ * OPERATOR NEW and DELETE
+ * Every form the library might call, so nothing slips
+ * past the count and nothing is freed by the wrong heap.
+ * The nothrow forms call these.
+ ***********************************************/
+void* operator new  (std::size_t size) { return allocate(size); }
+void* operator new[](std::size_t size) { return allocate(size); }
+void* operator new  (std::size_t size, std::align_val_t align) { return allocateAligned(size, align); }
+void* operator new[](std::size_t size, std::align_val_t align) { return allocateAligned(size, align); }
+
+void operator delete  (void* p) noexcept                   { std::free(p); }
+void operator delete[](void* p) noexcept                   { std::free(p); }
+void operator delete  (void* p, std::size_t) noexcept      { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept      { std::free(p); }
+void operator delete  (void* p, std::align_val_t) noexcept { freeAligned(p); }
+void operator delete[](void* p, std::align_val_t) noexcept { freeAligned(p); }
+void operator delete  (void* p, std::size_t, std::align_val_t) noexcept { freeAligned(p); }
+void operator delete[](void* p, std::size_t, std::align_val_t) noexcept { freeAligned(p); }
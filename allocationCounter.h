@@ -0,0 +1,30 @@
+/***********************************************************************
+ * Header File:
+ *    ALLOCATION COUNTER
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Count the heap allocations made while a fixture is alive
+ ************************************************************************/
+
+#pragma once
+
+/***************************************************
+ * ALLOCATION COUNTER
+ * Global operator new is replaced in allocationCounter.cpp to count
+ * every allocation on the calling thread. A counter remembers the
+ * total when it is created, so getCount() is what happened since.
+ ***************************************************/
+class AllocationCounter
+{
+public:
+   AllocationCounter() : start(getTotal()) {}
+
+   long long getCount() const { return getTotal() - start; }
+
+   // allocations made by this thread since it started
+   static long long getTotal();
+
+private:
+   long long start;
+};
@@ -0,0 +1,164 @@
+/***********************************************************************
+ * Source File:
+ *    BENCH
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The runner for all the micro-benchmarks
+ ************************************************************************/
+
+#include "bench.h"
+#include "benchmark.h"
+#include "position.h"
+#include "move.h"
+#include "board.h"
+#include "piece.h"
+#include "fen.h"
+#include "san.h"
+#include <iostream>
+using namespace std;
+
+/***************************************************
+ * BOARD BENCH
+ * A board with a piece on every square so that
+ * Board::operator[] always has something to return
+ ***************************************************/
+class BoardBench : public Board
+{
+public:
+   BoardBench()
+   {
+      for (int c = 0; c < 8; c++)
+         for (int r = 0; r < 8; r++)
+            board[c][r] = &pieces[c][r];
+   }
+private:
+   PieceDummy pieces[8][8];
+};
+
+/*****************************************************************
+ * BENCH RUNNER
+ * Runs all the micro-benchmarks, as text or as one JSON array
+ ****************************************************************/
+void benchRunner(bool json)
+{
+   const char* squares[] = { "a1", "e4", "h8", "d5", "b7", "g2", "c3", "f6" };
+   const char* moves[] = { "e2e4", "e5d6r", "e5d6E", "e1g1c", "e1c1C", "b7b8q" };
+   const char* fens[] =
+   {
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+      "8/2p5/3p4/KP5r/1R3p1k/8/4P1P1/8 w - - 0 1",
+   };
+   const char* sans[] = { "e4", "Nbd7", "exd6 e.p.", "O-O-O", "e8=Q+", "R1xa3" };
+   int i = 0;
+
+   vector<Benchmark> benchmarks;
+
+   // Position
+   benchmarks.emplace_back("Position(c, r)");
+   benchmarks.back().run([&]()
+   {
+      Position pos(i & 7, (i >> 3) & 7);
+      i++;
+      return pos.getLocation();
+   });
+
+   benchmarks.emplace_back("Position += Delta");
+   benchmarks.back().run([&]()
+   {
+      Position pos(i & 7, (i >> 3) & 7);
+      pos += (i++ & 1) ? ADD_R : SUB_C;
+      return pos.isValid();
+   });
+
+   benchmarks.emplace_back("Position = const char*");
+   benchmarks.back().run([&]()
+   {
+      Position pos;
+      pos = squares[i++ & 7];
+      return pos.getCol();
+   });
+
+   // Move
+   benchmarks.emplace_back("Move::readFromString");
+   benchmarks.back().run([&]()
+   {
+      Move move;
+      move.readFromString(moves[i++ % 6]);
+      return (int)move.getMoveType();
+   });
+
+   Move movesRead[6];
+   for (int j = 0; j < 6; j++)
+      movesRead[j].readFromString(moves[j]);
+   benchmarks.emplace_back("Move::getText");
+   benchmarks.back().run([&]()
+   {
+      return movesRead[i++ % 6].getText().size();
+   });
+
+   // Board
+   BoardBench board;
+   const BoardBench& boardConst = board;
+   Position positions[64];
+   for (int j = 0; j < 64; j++)
+      positions[j].set(j & 7, j >> 3);
+
+   benchmarks.emplace_back("Board::operator[] const");
+   benchmarks.back().run([&]()
+   {
+      return boardConst[positions[i++ & 63]].fWhite;
+   });
+
+   benchmarks.emplace_back("Board::operator[]");
+   benchmarks.back().run([&]()
+   {
+      return board[positions[i++ & 63]].fWhite;
+   });
+
+   benchmarks.emplace_back("Board::move");
+   benchmarks.back().run([&]()
+   {
+      board.move(movesRead[i++ % 6]);
+      return board.getCurrentMove();
+   });
+
+   // FEN and SAN
+   Fen fen;
+   benchmarks.emplace_back("Fen::read");
+   benchmarks.back().run([&]()
+   {
+      return fen.read(fens[i++ % 3]);
+   });
+
+   char buffer[Fen::MAX_LENGTH];
+   benchmarks.emplace_back("Fen::write");
+   benchmarks.back().run([&]()
+   {
+      return fen.write(buffer);
+   });
+
+   San san;
+   benchmarks.emplace_back("San::read");
+   benchmarks.back().run([&]()
+   {
+      return san.read(sans[i++ % 6]);
+   });
+
+   // report
+   if (json)
+   {
+      cout << "[\n";
+      for (size_t j = 0; j < benchmarks.size(); j++)
+      {
+         cout << "  ";
+         benchmarks[j].reportJSON(cout);
+         cout << (j + 1 < benchmarks.size() ? ",\n" : "\n");
+      }
+      cout << "]\n";
+   }
+   else
+      for (auto& benchmark : benchmarks)
+         benchmark.report(cout);
+}
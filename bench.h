@@ -0,0 +1,12 @@
+/***********************************************************************
+ * Header File:
+ *    BENCH
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The runner for all the micro-benchmarks
+ ************************************************************************/
+
+#pragma once
+
+void benchRunner(bool json);
@@ -0,0 +1,70 @@
+/***********************************************************************
+ * Source File:
+ *    BENCHMARK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Time an operation: warm up, repeat, and report the distribution
+ ************************************************************************/
+
+#include "benchmark.h"
+#include <cassert>
+#include <iomanip>
+#include <sstream>
+using namespace std;
+
+volatile long long Benchmark::sink = 0;
+
+/***********************************************
+ * BENCHMARK : GET PERCENTILE
+ * Linear interpolation between the two nearest samples
+ ***********************************************/
+double Benchmark::getPercentile(double percent) const
+{
+   assert(percent >= 0.0 && percent <= 100.0);
+   if (samples.empty())
+      return 0.0;
+
+   double rank = percent / 100.0 * (samples.size() - 1);
+   size_t below = (size_t)rank;
+   if (below + 1 >= samples.size())
+      return samples.back();
+   double fraction = rank - below;
+   return samples[below] + fraction * (samples[below + 1] - samples[below]);
+}
+
+/***********************************************
+ * BENCHMARK : REPORT
+ * name   median  p10  p90  (ns per call)
+ ***********************************************/
+void Benchmark::report(ostream& out) const
+{
+   // format locally so the caller's stream settings are left alone
+   ostringstream sout;
+   sout << left << setw(28) << name << right << fixed << setprecision(2)
+        << setw(10) << getMedian() << " ns"
+        << "   p10 " << setw(8) << getPercentile(10.0)
+        << "   p90 " << setw(8) << getPercentile(90.0)
+        << "   ("    << setprecision(1) << 1000.0 / getMedian() << " M/s)\n";
+   out << sout.str();
+}
+
+/***********************************************
+ * BENCHMARK : REPORT JSON
+ * The name is one of ours, so it needs no escaping
+ ***********************************************/
+void Benchmark::reportJSON(ostream& out) const
+{
+   ostringstream sout;
+   sout << fixed << setprecision(3)
+        << "{\"name\": \"" << name << "\""
+        << ", \"iterations\": " << numIterations
+        << ", \"repetitions\": " << numRepetitions
+        << ", \"median_ns\": " << getMedian()
+        << ", \"p10_ns\": "    << getPercentile(10.0)
+        << ", \"p90_ns\": "    << getPercentile(90.0)
+        << ", \"min_ns\": "    << getMin()
+        << ", \"max_ns\": "    << getMax()
+        << "}";
+   out << sout.str();
+}
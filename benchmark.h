@@ -0,0 +1,84 @@
+/***********************************************************************
+ * Header File:
+ *    BENCHMARK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Time an operation: warm up, repeat, and report the distribution
+ ************************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <ostream>
+#include <string>
+#include <vector>
+
+class TestBenchmark;
+
+/***************************************************
+ * BENCHMARK
+ * Time one operation. Each repetition calls it numIterations times
+ * and records the average nanoseconds per call. The warm-up
+ * repetitions are thrown away, and the rest are summarized by median
+ * and percentiles, which a stray context switch cannot move much.
+ ***************************************************/
+class Benchmark
+{
+   friend TestBenchmark;
+
+public:
+   Benchmark(const char* name, int numIterations = 100000,
+             int numRepetitions = 21, int numWarmups = 3) :
+      name(name), numIterations(numIterations),
+      numRepetitions(numRepetitions), numWarmups(numWarmups) {}
+
+   // The operation returns a value so the optimizer cannot drop the call
+   template <class Operation>
+   void run(Operation operation);
+
+   // nanoseconds per call
+   double getMedian()                  const { return getPercentile(50.0); }
+   double getPercentile(double percent) const;
+   double getMin()                     const { return getPercentile(0.0);   }
+   double getMax()                     const { return getPercentile(100.0); }
+
+   // one line of text, or one JSON object
+   void report(std::ostream& out) const;
+   void reportJSON(std::ostream& out) const;
+
+private:
+   std::string         name;
+   int                 numIterations;
+   int                 numRepetitions;
+   int                 numWarmups;
+   std::vector<double> samples;   // nanoseconds per call, sorted
+
+   static volatile long long sink;
+};
+
+/***************************************************
+ * BENCHMARK : RUN
+ ***************************************************/
+template <class Operation>
+void Benchmark::run(Operation operation)
+{
+   samples.clear();
+   long long total = 0;
+
+   for (int rep = 0; rep < numWarmups + numRepetitions; rep++)
+   {
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < numIterations; i++)
+         total += (long long)operation();
+      auto stop = std::chrono::steady_clock::now();
+
+      if (rep >= numWarmups)
+         samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count()
+                           / numIterations);
+   }
+
+   sink = sink + total;
+   std::sort(samples.begin(), samples.end());
+}
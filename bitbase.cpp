@@ -0,0 +1,197 @@
+/***********************************************************************
+ * Source File:
+ *    BITBASE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A precomputed win/draw table for King and Pawn versus King
+ ************************************************************************/
+
+#include "bitbase.h"
+#include <cassert>
+#include <cstdlib>
+#include <vector>
+using namespace std;
+
+/***********************************************
+ * Squares inside the table are numbered 0-63 with
+ * a1=0, b1=1, ... h8=63 so that one rank up is +8.
+ **********************************************/
+enum Result { KPK_INVALID = 0, KPK_UNKNOWN = 1, KPK_DRAW = 2, KPK_WIN = 4 };
+
+static int colOf(int sq) { return sq & 7;  }
+static int rowOf(int sq) { return sq >> 3; }
+
+/***********************************************
+ * DISTANCE
+ * How many king moves between two squares
+ **********************************************/
+static int distance(int sq1, int sq2)
+{
+   int dCol = abs(colOf(sq1) - colOf(sq2));
+   int dRow = abs(rowOf(sq1) - rowOf(sq2));
+   return dCol > dRow ? dCol : dRow;
+}
+
+/***********************************************
+ * PAWN ATTACKS
+ * Does a white pawn on one square attack the other?
+ **********************************************/
+static bool pawnAttacks(int sqPawn, int sq)
+{
+   return rowOf(sq) == rowOf(sqPawn) + 1 &&
+          abs(colOf(sq) - colOf(sqPawn)) == 1;
+}
+
+/***********************************************
+ * INDEX OF
+ * Pawn on files a-d and ranks 2-7, both kings anywhere
+ **********************************************/
+static int indexOf(bool whiteToMove, int wKing, int bKing, int pawn)
+{
+   assert(colOf(pawn) <= 3);
+   assert(rowOf(pawn) >= 1 && rowOf(pawn) <= 6);
+   return wKing | (bKing << 6) | ((whiteToMove ? 0 : 1) << 12) |
+          (colOf(pawn) << 13) | ((6 - rowOf(pawn)) << 15);
+}
+
+/***********************************************
+ * CLASSIFY INITIAL
+ * Positions that can be decided without looking ahead
+ **********************************************/
+static Result classifyInitial(bool whiteToMove, int wKing, int bKing, int pawn)
+{
+   // overlapping pieces, touching kings, or black in check with white to move
+   if (distance(wKing, bKing) <= 1 || wKing == pawn || bKing == pawn ||
+       (whiteToMove && pawnAttacks(pawn, bKing)))
+      return KPK_INVALID;
+
+   // white promotes next move and the new queen cannot be taken
+   if (whiteToMove && rowOf(pawn) == 6 && wKing != pawn + 8 &&
+       (distance(bKing, pawn + 8) > 1 || distance(wKing, pawn + 8) == 1))
+      return KPK_WIN;
+
+   if (!whiteToMove)
+   {
+      bool safeMove = false;
+      bool takesPawn = false;
+      for (int sq = 0; sq < 64; sq++)
+      {
+         if (distance(sq, bKing) != 1 || distance(sq, wKing) <= 1)
+            continue;
+         if (sq == pawn)
+            takesPawn = true;
+         else if (!pawnAttacks(pawn, sq))
+            safeMove = true;
+      }
+
+      // stalemate or the pawn is lost
+      if (!safeMove || takesPawn)
+         return KPK_DRAW;
+   }
+
+   return KPK_UNKNOWN;
+}
+
+/***********************************************
+ * CLASSIFY
+ * Combine the results of every move from this position.
+ * The side to move picks its best; invalid children add nothing.
+ **********************************************/
+static Result classify(const vector<uint8_t>& db, bool whiteToMove,
+                       int wKing, int bKing, int pawn)
+{
+   Result good = whiteToMove ? KPK_WIN  : KPK_DRAW;
+   Result bad  = whiteToMove ? KPK_DRAW : KPK_WIN;
+   int r = KPK_INVALID;
+
+   int king = whiteToMove ? wKing : bKing;
+   for (int sq = 0; sq < 64; sq++)
+      if (distance(sq, king) == 1)
+         r |= whiteToMove ? db[indexOf(false, sq, bKing, pawn)]
+                          : db[indexOf(true, wKing, sq, pawn)];
+
+   if (whiteToMove)
+   {
+      // a push to the eighth rank was already scored by classifyInitial
+      if (rowOf(pawn) < 6)
+         r |= db[indexOf(false, wKing, bKing, pawn + 8)];
+      if (rowOf(pawn) == 1 && pawn + 8 != wKing && pawn + 8 != bKing)
+         r |= db[indexOf(false, wKing, bKing, pawn + 16)];
+   }
+
+   if (r & good)
+      return good;
+   if (r & KPK_UNKNOWN)
+      return KPK_UNKNOWN;
+   return bad;
+}
+
+/***********************************************
+ * BITBASE : CONSTRUCTOR
+ * Retrograde analysis: iterate until no unknown position changes
+ **********************************************/
+Bitbase::Bitbase() : bits()
+{
+   vector<uint8_t> db(MAX_INDEX);
+
+   for (int i = 0; i < MAX_INDEX; i++)
+      db[i] = classifyInitial(((i >> 12) & 1) == 0, i & 63, (i >> 6) & 63,
+                              (6 - (i >> 15)) * 8 + ((i >> 13) & 3));
+
+   bool repeat = true;
+   while (repeat)
+   {
+      repeat = false;
+      for (int i = 0; i < MAX_INDEX; i++)
+         if (db[i] == KPK_UNKNOWN)
+         {
+            db[i] = classify(db, ((i >> 12) & 1) == 0, i & 63, (i >> 6) & 63,
+                             (6 - (i >> 15)) * 8 + ((i >> 13) & 3));
+            repeat |= db[i] != KPK_UNKNOWN;
+         }
+   }
+
+   for (int i = 0; i < MAX_INDEX; i++)
+      if (db[i] == KPK_WIN)
+         bits[i / 32] |= (uint32_t)1 << (i % 32);
+}
+
+/***********************************************
+ * BITBASE : GET
+ * Build the table on first use
+ **********************************************/
+const Bitbase& Bitbase::get()
+{
+   static const Bitbase bitbase;
+   return bitbase;
+}
+
+/***********************************************
+ * BITBASE : PROBE KPK
+ * Mirror the pawn onto files a-d and look up the bit.
+ * A pawn on the first or last rank is not in the table.
+ **********************************************/
+bool Bitbase::probeKPK(const Position& posKingStrong,
+                       const Position& posPawn,
+                       const Position& posKingWeak,
+                       bool strongToMove)
+{
+   assert(posKingStrong.isValid() && posPawn.isValid() && posKingWeak.isValid());
+
+   // the table only holds pawns on ranks 2-7
+   if (!posKingStrong.isValid() || !posPawn.isValid() || !posKingWeak.isValid() ||
+       posPawn.getRow() < 1 || posPawn.getRow() > 6)
+      return false;
+
+   bool mirror = posPawn.getCol() > 3;
+   int wKing = posKingStrong.getRow() * 8 +
+      (mirror ? 7 - posKingStrong.getCol() : posKingStrong.getCol());
+   int bKing = posKingWeak.getRow() * 8 +
+      (mirror ? 7 - posKingWeak.getCol() : posKingWeak.getCol());
+   int pawn = posPawn.getRow() * 8 +
+      (mirror ? 7 - posPawn.getCol() : posPawn.getCol());
+
+   int i = indexOf(strongToMove, wKing, bKing, pawn);
+   return (get().bits[i / 32] >> (i % 32)) & 1;
+}
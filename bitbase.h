@@ -0,0 +1,44 @@
+/***********************************************************************
+ * Header File:
+ *    BITBASE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A precomputed win/draw table for King and Pawn versus King
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "position.h"   // the squares of the three pieces
+
+class TestBitbase;
+
+/***************************************************
+ * BITBASE
+ * One bit per KPK position: set if the side with the pawn wins.
+ * The table is built by retrograde analysis the first time it is
+ * probed and takes 24K of memory.
+ ***************************************************/
+class Bitbase
+{
+   friend TestBitbase;
+
+public:
+   // Does the side with the pawn win? The strong side is always treated
+   // as white; mirror the ranks before calling when black has the pawn.
+   // The pawn must be on ranks 2-7; any other square returns false.
+   static bool probeKPK(const Position& posKingStrong,
+                        const Position& posPawn,
+                        const Position& posKingWeak,
+                        bool strongToMove);
+
+private:
+   // 2 sides to move * 24 pawn squares * 64 * 64 king squares
+   static const int MAX_INDEX = 2 * 24 * 64 * 64;
+
+   Bitbase();
+   static const Bitbase& get();
+
+   uint32_t bits[MAX_INDEX / 32];
+};
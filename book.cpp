@@ -0,0 +1,172 @@
+/***********************************************************************
+ * Source File:
+ *    BOOK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A Polyglot opening book read straight from a memory-mapped file
+ ************************************************************************/
+
+#include "book.h"
+#include <cassert>
+
+/***********************************************
+ * READ BIG ENDIAN
+ * Polyglot stores every number most significant byte first
+ ***********************************************/
+static uint64_t readBigEndian(const char* p, int numBytes)
+{
+   uint64_t value = 0;
+   for (int i = 0; i < numBytes; i++)
+      value = (value << 8) | (uint8_t)p[i];
+   return value;
+}
+
+/***********************************************
+ * BOOK : OPEN
+ * A book must be a whole number of entries
+ ***********************************************/
+bool Book::open(const char* filename)
+{
+   if (!file.open(filename))
+      return false;
+
+   if (file.size() % ENTRY_SIZE != 0)
+   {
+      file.close();
+      return false;
+   }
+   return true;
+}
+
+/***********************************************
+ * BOOK : GET KEY
+ * Only the key is needed during the search
+ ***********************************************/
+uint64_t Book::getKey(int i) const
+{
+   return readBigEndian(file.data() + (size_t)i * ENTRY_SIZE, 8);
+}
+
+/***********************************************
+ * BOOK : GET ENTRY
+ ***********************************************/
+Book::Entry Book::getEntry(int i) const
+{
+   const char* p = file.data() + (size_t)i * ENTRY_SIZE;
+   Entry entry;
+   entry.key    = readBigEndian(p,      8);
+   entry.move   = (uint16_t)readBigEndian(p + 8,  2);
+   entry.weight = (uint16_t)readBigEndian(p + 10, 2);
+   entry.learn  = (uint32_t)readBigEndian(p + 12, 4);
+   return entry;
+}
+
+/***********************************************
+ * BOOK : FIND FIRST
+ * Binary search for the first entry with this key,
+ * or the first one after it when the key is missing
+ ***********************************************/
+int Book::findFirst(uint64_t key) const
+{
+   int low = 0;
+   int high = size();
+   while (low < high)
+   {
+      int middle = low + (high - low) / 2;
+      if (getKey(middle) < key)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+   return low;
+}
+
+/***********************************************
+ * BOOK : FIND
+ * Collect the run of entries that share a key
+ ***********************************************/
+int Book::find(uint64_t key, Entry* entries, int max) const
+{
+   if (!isOpen())
+      return 0;
+
+   int num = 0;
+   for (int i = findFirst(key); i < size() && num < max && getKey(i) == key; i++)
+      entries[num++] = getEntry(i);
+   return num;
+}
+
+/***********************************************
+ * BOOK : PROBE
+ * The book move with the highest weight. Walk the whole
+ * run of matching entries so no buffer can cut it short.
+ ***********************************************/
+Move Book::probe(uint64_t key) const
+{
+   if (!isOpen())
+      return Move();
+
+   int iBest = -1;
+   uint16_t weightBest = 0;
+   for (int i = findFirst(key); i < size() && getKey(i) == key; i++)
+   {
+      uint16_t weight = (uint16_t)readBigEndian(file.data() + (size_t)i * ENTRY_SIZE + 10, 2);
+      if (iBest < 0 || weight > weightBest)
+      {
+         iBest = i;
+         weightBest = weight;
+      }
+   }
+
+   if (iBest < 0)
+      return Move();
+   return moveFromPolyglot(getEntry(iBest).move);
+}
+
+/***********************************************
+ * BOOK : MOVE FROM POLYGLOT
+ * bits 0-2 to file, 3-5 to row, 6-8 from file,
+ * 9-11 from row, 12-14 promotion (none,n,b,r,q).
+ * Castling is stored as the king taking its own rook.
+ * We cannot see the board, so e1h1, e1a1, e8h8 and e8a8
+ * are always read as castling. The colour is set when the
+ * move itself shows it: castling and promotion from the
+ * eighth or seventh rank are black's.
+ ***********************************************/
+Move Book::moveFromPolyglot(uint16_t polyglot)
+{
+   static const PieceType promotions[8] =
+      { SPACE, KNIGHT, BISHOP, ROOK, QUEEN, SPACE, SPACE, SPACE };
+
+   Position source((polyglot >> 6) & 7, (polyglot >> 9) & 7);
+   Position dest(polyglot & 7, (polyglot >> 3) & 7);
+
+   Move move;
+   move.setSource(source);
+   move.setDest(dest);
+   move.setPromote(promotions[(polyglot >> 12) & 7]);
+
+   if (move.getPromote() != SPACE)
+      move.setWhite(source.getRow() == 6);
+
+   bool fromKingSquare = source.getCol() == 4 &&
+                        (source.getRow() == 0 || source.getRow() == 7);
+   if (fromKingSquare && dest.getRow() == source.getRow())
+   {
+      if (dest.getCol() == 7)
+      {
+         move.setMoveType(Move::CASTLE_KING);
+         move.setDest(Position(6, dest.getRow()));
+         move.setWhite(source.getRow() == 0);
+      }
+      else if (dest.getCol() == 0)
+      {
+         move.setMoveType(Move::CASTLE_QUEEN);
+         move.setDest(Position(2, dest.getRow()));
+         move.setWhite(source.getRow() == 0);
+      }
+   }
+
+   return move;
+}
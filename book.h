@@ -0,0 +1,61 @@
+/***********************************************************************
+ * Header File:
+ *    BOOK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A Polyglot opening book read straight from a memory-mapped file
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "move.h"         // book entries are turned into Moves
+#include "mappedFile.h"   // the book is never loaded into RAM
+
+class TestBook;
+
+/***************************************************
+ * BOOK
+ * A Polyglot .bin file is a sorted array of 16 byte big-endian
+ * entries: key (8), move (2), weight (2), learn (4). Lookups are a
+ * binary search over the mapped file; polyglotKey() makes the key.
+ ***************************************************/
+class Book
+{
+   friend TestBook;
+
+public:
+   // one book entry, converted to host byte order
+   struct Entry
+   {
+      uint64_t key;
+      uint16_t move;
+      uint16_t weight;
+      uint32_t learn;
+   };
+
+   bool open(const char* filename);
+   void close()        { file.close();                    }
+   bool isOpen() const { return file.isOpen();            }
+   int  size()   const { return (int)(file.size() / ENTRY_SIZE); }
+
+   // fill entries with every move stored for a key. Returns how many.
+   int find(uint64_t key, Entry* entries, int max) const;
+
+   // The highest-weight move for a key, or a Move with an invalid source.
+   // Every entry for the key is considered, however many there are.
+   Move probe(uint64_t key) const;
+
+   // convert a Polyglot move to our Move
+   static Move moveFromPolyglot(uint16_t move);
+
+private:
+   static const int ENTRY_SIZE = 16;
+
+   Entry getEntry(int i) const;
+   uint64_t getKey(int i) const;
+   int findFirst(uint64_t key) const;
+
+   MappedFile file;
+};
@@ -0,0 +1,296 @@
+/***********************************************************************
+ * Source File:
+ *    FEN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Read and write Forsyth-Edwards Notation
+ ************************************************************************/
+
+#include "fen.h"
+#include <cassert>
+
+/***********************************************
+ * PIECE FROM LETTER
+ * 'P' is a white pawn, 'p' a black one
+ ***********************************************/
+static PieceType pieceFromLetter(char letter)
+{
+   switch (letter | 0x20)   // lower case
+   {
+   case 'p': return PAWN;
+   case 'n': return KNIGHT;
+   case 'b': return BISHOP;
+   case 'r': return ROOK;
+   case 'q': return QUEEN;
+   case 'k': return KING;
+   default:  return INVALID;
+   }
+}
+
+/***********************************************
+ * LETTER FROM PIECE
+ ***********************************************/
+static char letterFromPiece(PieceType pt, bool isWhite)
+{
+   static const char letters[] = "??kqrbnp";   // in PieceType order
+   char letter = letters[pt];
+   return isWhite ? (char)(letter - 0x20) : letter;
+}
+
+/***********************************************
+ * READ NUMBER
+ * A run of digits no larger than MAX_COUNTER; advances the
+ * pointer. On overflow it stops on the offending digit.
+ ***********************************************/
+static bool readNumber(const char*& p, int& value)
+{
+   if (*p < '0' || *p > '9')
+      return false;
+   value = 0;
+   while (*p >= '0' && *p <= '9')
+   {
+      if (value > (Fen::MAX_COUNTER - (*p - '0')) / 10)
+         return false;
+      value = value * 10 + (*p++ - '0');
+   }
+   return true;
+}
+
+/***********************************************
+ * WRITE NUMBER
+ * Digits of a non-negative number; advances the pointer
+ ***********************************************/
+static void writeNumber(char*& p, int value)
+{
+   char digits[12];
+   int num = 0;
+   do
+   {
+      digits[num++] = (char)('0' + value % 10);
+      value /= 10;
+   }
+   while (value > 0);
+   while (num > 0)
+      *p++ = digits[--num];
+}
+
+/***********************************************
+ * FEN : CLEAR
+ * An empty board, white to move, no rights
+ ***********************************************/
+void Fen::clear()
+{
+   for (int c = 0; c < 8; c++)
+      for (int r = 0; r < 8; r++)
+      {
+         type[c][r] = SPACE;
+         fWhite[c][r] = false;
+      }
+   fWhiteTurn = true;
+   castle = 0;
+   enPassant.setInvalid();
+   halfMoves = 0;
+   fullMoves = 1;
+}
+
+/***********************************************
+ * FEN : SET
+ * Put a piece (or SPACE) on a square
+ ***********************************************/
+void Fen::set(const Position& pos, PieceType pt, bool isWhite)
+{
+   assert(pos.isValid());
+   type[pos.getCol()][pos.getRow()] = pt;
+   fWhite[pos.getCol()][pos.getRow()] = isWhite;
+}
+
+/***********************************************
+ * FEN : READ
+ * rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1
+ ***********************************************/
+bool Fen::read(const char* text)
+{
+   assert(text);
+   clear();
+   const char* p = text;
+
+   // 1. piece placement, from the eighth rank down
+   int row = 7;
+   int col = 0;
+   for (; *p && *p != ' '; p++)
+   {
+      if (*p == '/')
+      {
+         if (col != 8 || row == 0)
+            break;
+         row--;
+         col = 0;
+      }
+      else if (*p >= '1' && *p <= '8')
+         col += *p - '0';
+      else
+      {
+         PieceType pt = pieceFromLetter(*p);
+         if (pt == INVALID || col > 7)
+            break;
+         type[col][row] = pt;
+         fWhite[col][row] = (*p < 'a');
+         col++;
+      }
+      if (col > 8)
+         break;
+   }
+   if (*p != ' ' || row != 0 || col != 8)
+   {
+      clear();
+      return false;
+   }
+
+   // 2. side to move
+   p++;
+   if (*p == 'w')
+      fWhiteTurn = true;
+   else if (*p == 'b')
+      fWhiteTurn = false;
+   else
+   {
+      clear();
+      return false;
+   }
+   p++;
+
+   // 3. castling rights
+   if (*p++ != ' ')
+   {
+      clear();
+      return false;
+   }
+   if (*p == '-')
+      p++;
+   else
+      for (; *p && *p != ' '; p++)
+         switch (*p)
+         {
+         case 'K': castle |= CASTLE_WHITE_KING;  break;
+         case 'Q': castle |= CASTLE_WHITE_QUEEN; break;
+         case 'k': castle |= CASTLE_BLACK_KING;  break;
+         case 'q': castle |= CASTLE_BLACK_QUEEN; break;
+         default:
+            clear();
+            return false;
+         }
+
+   // 4. en passant square: the sixth rank when white is to move,
+   //    the third when black is
+   if (*p++ != ' ')
+   {
+      clear();
+      return false;
+   }
+   if (*p == '-')
+      p++;
+   else if (p[0] >= 'a' && p[0] <= 'h' && p[1] == (fWhiteTurn ? '6' : '3'))
+   {
+      enPassant.set(p[0] - 'a', p[1] - '1');
+      p += 2;
+   }
+   else
+   {
+      clear();
+      return false;
+   }
+
+   // 5. and 6. the move counters, missing in EPD
+   if (*p == ' ')
+   {
+      const char* pCounters = p + 1;
+      int half;
+      int full;
+      if (readNumber(pCounters, half) && *pCounters == ' ' &&
+          readNumber(++pCounters, full))
+      {
+         halfMoves = half;
+         fullMoves = full > 0 ? full : 1;
+      }
+
+      // readNumber stopped on a digit: the counter is out of range
+      else if (*pCounters >= '0' && *pCounters <= '9')
+      {
+         clear();
+         return false;
+      }
+   }
+
+   return true;
+}
+
+/***********************************************
+ * FEN : WRITE
+ * The inverse of read()
+ ***********************************************/
+int Fen::write(char* buffer) const
+{
+   assert(buffer);
+   char* p = buffer;
+
+   for (int row = 7; row >= 0; row--)
+   {
+      int empty = 0;
+      for (int col = 0; col < 8; col++)
+      {
+         if (type[col][row] == SPACE || type[col][row] == INVALID)
+            empty++;
+         else
+         {
+            if (empty)
+               *p++ = (char)('0' + empty);
+            empty = 0;
+            *p++ = letterFromPiece(type[col][row], fWhite[col][row]);
+         }
+      }
+      if (empty)
+         *p++ = (char)('0' + empty);
+      if (row > 0)
+         *p++ = '/';
+   }
+
+   *p++ = ' ';
+   *p++ = fWhiteTurn ? 'w' : 'b';
+
+   *p++ = ' ';
+   if (castle == 0)
+      *p++ = '-';
+   if (castle & CASTLE_WHITE_KING)  *p++ = 'K';
+   if (castle & CASTLE_WHITE_QUEEN) *p++ = 'Q';
+   if (castle & CASTLE_BLACK_KING)  *p++ = 'k';
+   if (castle & CASTLE_BLACK_QUEEN) *p++ = 'q';
+
+   *p++ = ' ';
+   if (enPassant.isValid())
+   {
+      *p++ = (char)('a' + enPassant.getCol());
+      *p++ = (char)('1' + enPassant.getRow());
+   }
+   else
+      *p++ = '-';
+
+   *p++ = ' ';
+   writeNumber(p, halfMoves);
+   *p++ = ' ';
+   writeNumber(p, fullMoves);
+   *p = '\0';
+
+   assert(p - buffer < MAX_LENGTH);
+   return (int)(p - buffer);
+}
+
+/***********************************************
+ * FEN : GET TEXT
+ ***********************************************/
+std::string Fen::getText() const
+{
+   char buffer[MAX_LENGTH];
+   int length = write(buffer);
+   return std::string(buffer, length);
+}
@@ -0,0 +1,89 @@
+/***********************************************************************
+ * Header File:
+ *    FEN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Read and write Forsyth-Edwards Notation
+ ************************************************************************/
+
+#pragma once
+
+#include <cassert>
+#include <string>
+#include "position.h"    // squares on the board
+#include "pieceType.h"   // what sits on each square
+
+class TestFen;
+
+/***************************************************
+ * FEN
+ * Everything a FEN string describes: the pieces, whose turn it is,
+ * castling rights, the en passant square, and the two move counters.
+ * Reading and writing each make one pass with no allocations.
+ ***************************************************/
+class Fen
+{
+   friend TestFen;
+
+public:
+   // castling rights, one bit each
+   enum { CASTLE_WHITE_KING  = 0x01, CASTLE_WHITE_QUEEN = 0x02,
+          CASTLE_BLACK_KING  = 0x04, CASTLE_BLACK_QUEEN = 0x08 };
+
+   // the longest FEN write() can produce, including the terminator
+   static const int MAX_LENGTH = 128;
+
+   // the largest move counter read() accepts
+   static const int MAX_COUNTER = 99999;
+
+   Fen() { clear(); }
+
+   // Parse a FEN. The two move counters are optional so EPD works too,
+   // but a counter above MAX_COUNTER is an error.
+   // On failure the Fen is cleared and false is returned.
+   bool read(const char* text);
+   bool read(const std::string& text) { return read(text.c_str()); }
+
+   // Write into a buffer of at least MAX_LENGTH. Returns the length.
+   int write(char* buffer) const;
+   std::string getText() const;
+
+   // getters
+   PieceType getType(const Position& pos) const
+   {
+      assert(pos.isValid());
+      return type[pos.getCol()][pos.getRow()];
+   }
+   bool      isWhite(const Position& pos) const
+   {
+      assert(pos.isValid());
+      return fWhite[pos.getCol()][pos.getRow()];
+   }
+   bool      whiteTurn()       const { return fWhiteTurn;   }
+   int       getCastle()       const { return castle;       }
+   Position  getEnPassant()    const { return enPassant;    }
+   int       getHalfMoves()    const { return halfMoves;    }
+   int       getFullMoves()    const { return fullMoves;    }
+
+   // The same count as Board::getCurrentMove(): plies since the start
+   int getCurrentMove() const { return (fullMoves - 1) * 2 + (fWhiteTurn ? 0 : 1); }
+
+   // setters
+   void clear();
+   void set(const Position& pos, PieceType pt, bool isWhite);
+   void setWhiteTurn(bool isWhite)        { fWhiteTurn = isWhite;        }
+   void setCastle(int castle)             { this->castle = castle;       }
+   void setEnPassant(const Position& pos) { enPassant = pos;             }
+   void setHalfMoves(int halfMoves)       { this->halfMoves = halfMoves; }
+   void setFullMoves(int fullMoves)       { this->fullMoves = fullMoves; }
+
+private:
+   PieceType type[8][8];     // [col][row] as in Board
+   bool      fWhite[8][8];   // color of the piece on each square
+   bool      fWhiteTurn;     // whose turn is it?
+   int       castle;         // CASTLE_* bits
+   Position  enPassant;      // square behind a pawn that just moved two
+   int       halfMoves;      // plies since the last capture or pawn move
+   int       fullMoves;      // starts at 1, incremented after black moves
+};
@@ -0,0 +1,192 @@
+/***********************************************************************
+ * Source File:
+ *    GAME RECORD
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A compact binary file of games, two bytes per move
+ ************************************************************************/
+
+#include "gameRecord.h"
+#include "board.h"
+#include <cassert>
+#include <cstring>
+
+static const char MAGIC[] = "CGR1";
+
+/***********************************************
+ * The 4-bit move codes
+ ***********************************************/
+enum
+{
+   CODE_MOVE, CODE_ENPASSANT, CODE_CASTLE_KING, CODE_CASTLE_QUEEN,
+   CODE_KNIGHT, CODE_BISHOP, CODE_ROOK, CODE_QUEEN
+};
+
+/***********************************************
+ * SQUARE : a1=0 b1=1 ... h8=63
+ ***********************************************/
+static int squareFromPosition(const Position& pos)
+{
+   return pos.getRow() * 8 + pos.getCol();
+}
+
+/***********************************************
+ * GAME RECORD : ENCODE
+ * The capture is not stored: the board knows
+ * what stands on the destination square.
+ ***********************************************/
+uint16_t GameRecord::encode(const Move& move)
+{
+   assert(move.getSource().isValid() && move.getDest().isValid());
+
+   int code = CODE_MOVE;
+   switch (move.getMoveType())
+   {
+   case Move::ENPASSANT:    code = CODE_ENPASSANT;    break;
+   case Move::CASTLE_KING:  code = CODE_CASTLE_KING;  break;
+   case Move::CASTLE_QUEEN: code = CODE_CASTLE_QUEEN; break;
+   default:
+      switch (move.getPromote())
+      {
+      case KNIGHT: code = CODE_KNIGHT; break;
+      case BISHOP: code = CODE_BISHOP; break;
+      case ROOK:   code = CODE_ROOK;   break;
+      case QUEEN:  code = CODE_QUEEN;  break;
+      default:                         break;
+      }
+   }
+
+   return (uint16_t)(squareFromPosition(move.getSource()) |
+                     (squareFromPosition(move.getDest()) << 6) |
+                     (code << 12));
+}
+
+/***********************************************
+ * GAME RECORD : DECODE
+ ***********************************************/
+Move GameRecord::decode(uint16_t code)
+{
+   static const PieceType promotions[16] =
+   {
+      SPACE, SPACE, SPACE, SPACE, KNIGHT, BISHOP, ROOK, QUEEN,
+      SPACE, SPACE, SPACE, SPACE, SPACE,  SPACE,  SPACE, SPACE
+   };
+   static const Move::MoveType moveTypes[16] =
+   {
+      Move::MOVE, Move::ENPASSANT, Move::CASTLE_KING, Move::CASTLE_QUEEN,
+      Move::MOVE, Move::MOVE, Move::MOVE, Move::MOVE,
+      Move::MOVE_ERROR, Move::MOVE_ERROR, Move::MOVE_ERROR, Move::MOVE_ERROR,
+      Move::MOVE_ERROR, Move::MOVE_ERROR, Move::MOVE_ERROR, Move::MOVE_ERROR
+   };
+
+   int source = code & 63;
+   int dest = (code >> 6) & 63;
+   int special = code >> 12;
+
+   Move move;
+   move.setSource(Position(source & 7, source >> 3));
+   move.setDest(Position(dest & 7, dest >> 3));
+   move.setMoveType(moveTypes[special]);
+   move.setPromote(promotions[special]);
+   return move;
+}
+
+/***********************************************
+ * GAME RECORD : WRITE HEADER
+ * Once at the start of the file
+ ***********************************************/
+void GameRecord::writeHeader(std::ostream& out)
+{
+   out.write(MAGIC, HEADER_SIZE);
+}
+
+/***********************************************
+ * GAME RECORD : WRITE
+ * One game, in a single write
+ ***********************************************/
+void GameRecord::write(std::ostream& out, const Move* moves, int numMoves,
+                       Result result)
+{
+   assert(numMoves >= 0 && numMoves <= MAX_MOVES);
+
+   char buffer[GAME_HEADER_SIZE + 2 * 256];
+   char* p = buffer;
+   *p++ = (char)(numMoves & 0xFF);
+   *p++ = (char)(numMoves >> 8);
+   *p++ = (char)result;
+
+   for (int i = 0; i < numMoves; i++)
+   {
+      if (p == buffer + sizeof(buffer))
+      {
+         out.write(buffer, p - buffer);
+         p = buffer;
+      }
+      uint16_t code = encode(moves[i]);
+      *p++ = (char)(code & 0xFF);
+      *p++ = (char)(code >> 8);
+   }
+   out.write(buffer, p - buffer);
+}
+
+/***********************************************
+ * GAME RECORD : CONSTRUCTOR
+ * Check the magic number; the first game comes from next()
+ ***********************************************/
+GameRecord::GameRecord(const char* begin, const char* end) :
+   p(begin), pEnd(end), pMoves(nullptr), numMoves(0),
+   result(RESULT_UNKNOWN), fValid(false)
+{
+   if (end - begin >= HEADER_SIZE && memcmp(begin, MAGIC, HEADER_SIZE) == 0)
+   {
+      fValid = true;
+      p += HEADER_SIZE;
+   }
+   else
+      p = pEnd;
+}
+
+/***********************************************
+ * GAME RECORD : NEXT
+ ***********************************************/
+bool GameRecord::next()
+{
+   numMoves = 0;
+   pMoves = nullptr;
+   if (pEnd - p < GAME_HEADER_SIZE)
+      return false;
+
+   // a short game or an unknown result means the file is damaged
+   int num = (uint8_t)p[0] | ((uint8_t)p[1] << 8);
+   if (pEnd - p < GAME_HEADER_SIZE + 2 * num || (uint8_t)p[2] > DRAW)
+   {
+      p = pEnd;
+      return false;
+   }
+
+   result = (Result)(uint8_t)p[2];
+   numMoves = num;
+   pMoves = p + GAME_HEADER_SIZE;
+   p = pMoves + 2 * num;
+   return true;
+}
+
+/***********************************************
+ * GAME RECORD : GET MOVE
+ ***********************************************/
+Move GameRecord::getMove(int i) const
+{
+   assert(i >= 0 && i < numMoves);
+   return decode((uint16_t)((uint8_t)pMoves[2 * i] |
+                            ((uint8_t)pMoves[2 * i + 1] << 8)));
+}
+
+/***********************************************
+ * GAME RECORD : REPLAY
+ ***********************************************/
+void GameRecord::replay(Board& board) const
+{
+   for (int i = 0; i < numMoves; i++)
+      board.move(getMove(i));
+}
@@ -0,0 +1,70 @@
+/***********************************************************************
+ * Header File:
+ *    GAME RECORD
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A compact binary file of games, two bytes per move
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include "move.h"
+
+class Board;
+class TestGameRecord;
+
+/***************************************************
+ * GAME RECORD
+ * The file starts with the four bytes "CGR1". Each game is then a
+ * little-endian 16-bit move count, a result byte, and the moves.
+ * A move is 16 bits: source (6), destination (6), and a 4-bit code
+ * for en passant, castling, or the promotion piece.
+ *
+ * Writing goes to any ostream. Reading walks a range of memory,
+ * usually a MappedFile, one game at a time.
+ ***************************************************/
+class GameRecord
+{
+   friend TestGameRecord;
+
+public:
+   enum Result { RESULT_UNKNOWN, WHITE_WINS, BLACK_WINS, DRAW };
+
+   static const int MAX_MOVES = 0xFFFF;
+
+   // one move to and from its two byte form
+   static uint16_t encode(const Move& move);
+   static Move     decode(uint16_t code);
+
+   // writing
+   static void writeHeader(std::ostream& out);
+   static void write(std::ostream& out, const Move* moves, int numMoves,
+                     Result result);
+
+   // reading: the range must hold a whole file, header included
+   GameRecord(const char* begin, const char* end);
+   bool isValid() const { return fValid; }
+
+   // step to the next game. Returns false at the end or on a short game.
+   bool   next();
+   int    getNumMoves() const { return numMoves; }
+   Result getResult()   const { return result;   }
+   Move   getMove(int i) const;
+
+   // play every move of the current game on the board
+   void replay(Board& board) const;
+
+private:
+   static const int HEADER_SIZE = 4;
+   static const int GAME_HEADER_SIZE = 3;
+
+   const char* p;          // the next game
+   const char* pEnd;       // one past the last byte
+   const char* pMoves;     // the moves of the current game
+   int         numMoves;   // how many moves in the current game
+   Result      result;     // how the current game ended
+   bool        fValid;     // did the header check out?
+};
@@ -0,0 +1,56 @@
+/***********************************************************************
+ * Source File:
+ *    HISTORY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Position hashes since the start of the game, for draw detection
+ ************************************************************************/
+
+#include "history.h"
+
+/***********************************************
+ * HISTORY : RESET
+ ***********************************************/
+void History::reset(uint64_t key, int halfMovesStart)
+{
+   assert(halfMovesStart >= 0);
+   keys[0] = key;
+   halfMoves[0] = halfMovesStart;
+   numPlies = 1;
+}
+
+/***********************************************
+ * HISTORY : PUSH
+ ***********************************************/
+void History::push(uint64_t key, bool irreversible)
+{
+   assert(numPlies > 0);
+   int i = numPlies & (MAX_PLIES - 1);
+   keys[i] = key;
+   halfMoves[i] = irreversible ? 0 : getHalfMoves() + 1;
+   numPlies++;
+}
+
+/***********************************************
+ * HISTORY : GET REPETITIONS
+ * Step back two plies at a time, no further than
+ * the last irreversible move or the oldest entry
+ * still in the ring. A repeat needs at least four plies.
+ ***********************************************/
+int History::getRepetitions() const
+{
+   int current = numPlies - 1;
+   int depth = getHalfMoves();
+   if (depth > current)
+      depth = current;
+   if (depth > MAX_PLIES - 1)
+      depth = MAX_PLIES - 1;
+
+   uint64_t key = keys[current & (MAX_PLIES - 1)];
+   int count = 0;
+   for (int back = 4; back <= depth; back += 2)
+      if (keys[(current - back) & (MAX_PLIES - 1)] == key)
+         count++;
+   return count;
+}
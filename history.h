@@ -0,0 +1,61 @@
+/***********************************************************************
+ * Header File:
+ *    HISTORY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Position hashes since the start of the game, for draw detection
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <cassert>
+
+class TestHistory;
+
+/***************************************************
+ * HISTORY
+ * A ring of position hashes, one per ply, with the halfmove clock
+ * that goes with each. The game pushes a key after every move and a
+ * search pushes and pops on top of it. A position can only repeat
+ * since the last capture or pawn move, and only with the same side to
+ * move, so a repetition check reads at most halfMoves / 2 entries.
+ ***************************************************/
+class History
+{
+   friend TestHistory;
+
+public:
+   // must be a power of two and more than the 100 plies of the fifty move rule
+   static const int MAX_PLIES = 1024;
+
+   // an empty game with key 0, so the getters are safe before reset()
+   History() { reset(0); }
+
+   // start of a game, or a position read from FEN
+   void reset(uint64_t key, int halfMoves = 0);
+
+   // after a move: irreversible means a capture or a pawn move
+   void push(uint64_t key, bool irreversible);
+
+   // take back the last move, as a search does
+   void pop()
+   {
+      assert(numPlies > 1);
+      numPlies--;
+   }
+
+   // how many earlier times the current position has been seen
+   int  getRepetitions() const;
+   bool isRepetition()   const { return getRepetitions() >= 1; }
+   bool isThreefold()    const { return getRepetitions() >= 2; }
+
+   int  getHalfMoves()   const { return halfMoves[(numPlies - 1) & (MAX_PLIES - 1)]; }
+   bool isFiftyMoves()   const { return getHalfMoves() >= 100; }
+
+private:
+   uint64_t keys[MAX_PLIES];        // position hash at each ply
+   int      halfMoves[MAX_PLIES];   // the halfmove clock at each ply
+   int      numPlies;               // plies pushed, including the first position
+};
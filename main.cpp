@@ -4,20 +4,40 @@
  * Author:
  *    <your name here>
  * Summary:
- *    Launches the unit tests - that is all!
+ *    Launches the unit tests, the performance tests, or the benchmarks
  ************************************************************************/
 
  #include "test.h"
+ #include "bench.h"
+ #include <cstring>
 
  /************************************
   * MAIN
   * There can be only one!
+  *    Lab03                      run the unit tests
+  *    Lab03 perftest             run the performance tests
+  *    Lab03 microbench [--json]  run the micro-benchmarks
+  * "bench" is left for a fixed-depth search signature.
   ************************************/
-int main()
+int main(int argc, char** argv)
 {
+   // run the benchmarks instead of the tests
+   if (argc > 1 && strcmp(argv[1], "microbench") == 0)
+   {
+      benchRunner(argc > 2 && strcmp(argv[2], "--json") == 0);
+      return 0;
+   }
+
+   // run the time budgets and heap checks instead of the tests
+   if (argc > 1 && strcmp(argv[1], "perftest") == 0)
+   {
+      perfRunner();
+      return 0;
+   }
+
    // run the test code.
    testRunner();
 
    // return success
    return 0;
-}
\ No newline at end of file
+}
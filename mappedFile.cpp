@@ -0,0 +1,101 @@
+/***********************************************************************
+ * Source File:
+ *    MAPPED FILE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A read-only view of a file mapped into memory
+ ************************************************************************/
+
+#include "mappedFile.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+/***********************************************
+ * MAPPED FILE : OPEN
+ * Map the whole file. Returns false if the file
+ * cannot be opened or is empty.
+ ***********************************************/
+bool MappedFile::open(const char* filename)
+{
+   close();
+
+#ifdef _WIN32
+   HANDLE hFile = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (hFile == INVALID_HANDLE_VALUE)
+      return false;
+
+   LARGE_INTEGER fileSize;
+   if (!GetFileSizeEx(hFile, &fileSize) || fileSize.QuadPart == 0)
+   {
+      CloseHandle(hFile);
+      return false;
+   }
+
+   HANDLE hMap = CreateFileMappingA(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+   CloseHandle(hFile);
+   if (hMap == NULL)
+      return false;
+
+   void* p = MapViewOfFile(hMap, FILE_MAP_READ, 0, 0, 0);
+   if (p == NULL)
+   {
+      CloseHandle(hMap);
+      return false;
+   }
+
+   handle = hMap;
+   numBytes = (size_t)fileSize.QuadPart;
+#else
+   int fd = ::open(filename, O_RDONLY);
+   if (fd < 0)
+      return false;
+
+   struct stat st;
+   if (fstat(fd, &st) != 0 || st.st_size == 0)
+   {
+      ::close(fd);
+      return false;
+   }
+
+   // the mapping stays valid after the descriptor is closed
+   void* p = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+   ::close(fd);
+   if (p == MAP_FAILED)
+      return false;
+
+   numBytes = (size_t)st.st_size;
+#endif
+
+   pData = (const char*)p;
+   return true;
+}
+
+/***********************************************
+ * MAPPED FILE : CLOSE
+ * Release the mapping. Safe to call more than once.
+ ***********************************************/
+void MappedFile::close()
+{
+   if (pData == nullptr)
+      return;
+
+#ifdef _WIN32
+   UnmapViewOfFile(pData);
+   CloseHandle((HANDLE)handle);
+#else
+   munmap((void*)pData, numBytes);
+#endif
+
+   pData = nullptr;
+   numBytes = 0;
+   handle = nullptr;
+}
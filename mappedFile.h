@@ -0,0 +1,40 @@
+/***********************************************************************
+ * Header File:
+ *    MAPPED FILE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A read-only view of a file mapped into memory
+ ************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+
+/***************************************************
+ * MAPPED FILE
+ * The operating system pages the file in as it is read,
+ * so even very large files cost nothing to open.
+ ***************************************************/
+class MappedFile
+{
+public:
+   MappedFile() : pData(nullptr), numBytes(0), handle(nullptr) {}
+   ~MappedFile() { close(); }
+
+   // no copying: the mapping belongs to one object
+   MappedFile(const MappedFile& rhs) = delete;
+   MappedFile& operator = (const MappedFile& rhs) = delete;
+
+   bool open(const char* filename);
+   void close();
+
+   bool        isOpen() const { return pData != nullptr; }
+   const char* data()   const { return pData;            }
+   size_t      size()   const { return numBytes;         }
+
+private:
+   const char* pData;      // the first byte of the file
+   size_t      numBytes;   // the size of the file
+   void*       handle;     // the Windows mapping object, unused elsewhere
+};
@@ -50,6 +50,22 @@ public:
 	// Get the text of a move
 	std::string getText() const;
 
+	// Getters
+	const Position& getSource()   const { return source;   }
+	const Position& getDest()     const { return dest;     }
+	PieceType       getPromote()  const { return promote;  }
+	PieceType       getCapture()  const { return capture;  }
+	MoveType        getMoveType() const { return moveType; }
+	bool            getWhite()    const { return isWhite;  }
+
+	// Setters
+	void setSource(const Position& pos)  { source = pos;    }
+	void setDest(const Position& pos)    { dest = pos;      }
+	void setPromote(PieceType pt)        { promote = pt;    }
+	void setCapture(PieceType pt)        { capture = pt;    }
+	void setMoveType(MoveType mt)        { moveType = mt;   }
+	void setWhite(bool fWhite)           { isWhite = fWhite; }
+
 private:
 	Position  source;    // where the move originated from
 	Position  dest;      // where the move finished
@@ -0,0 +1,282 @@
+/***********************************************************************
+ * Source File:
+ *    PACKED POSITION
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A 32 byte binary position and a block-compressed file of them
+ ************************************************************************/
+
+#include "packedPosition.h"
+#include <cassert>
+#include <cstring>
+using namespace std;
+
+static const char MAGIC[] = "PKP1";
+static const int HEADER_SIZE = 4;
+static const int BLOCK_HEADER_SIZE = 8;
+
+/***********************************************
+ * READ / WRITE 32 BIT little endian
+ ***********************************************/
+static uint32_t read32(const uint8_t* p)
+{
+   return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+static void write32(char* p, uint32_t value)
+{
+   for (int i = 0; i < 4; i++)
+      p[i] = (char)(value >> (8 * i));
+}
+
+/***********************************************
+ * PACKED POSITION : ENCODE
+ ***********************************************/
+bool PackedPosition::encode(const Fen& fen)
+{
+   memset(bytes, 0, SIZE);
+
+   // decode() has 16 bits for the move and derives the en passant rank
+   Position posEnPassant = fen.getEnPassant();
+   if (fen.getFullMoves() > 0xFFFF ||
+       (posEnPassant.isValid() && posEnPassant.getRow() != (fen.whiteTurn() ? 5 : 2)))
+      return false;
+
+   uint64_t occupancy = 0;
+   int numPieces = 0;
+   for (int sq = 0; sq < 64; sq++)
+   {
+      Position pos(sq & 7, sq >> 3);
+      PieceType pt = fen.getType(pos);
+      if (pt == SPACE || pt == INVALID)
+         continue;
+      if (numPieces == 32)
+         return false;
+
+      occupancy |= (uint64_t)1 << sq;
+      int code = pt | (fen.isWhite(pos) ? 0 : 8);
+      bytes[8 + numPieces / 2] |= (uint8_t)(code << (4 * (numPieces & 1)));
+      numPieces++;
+   }
+
+   for (int i = 0; i < 8; i++)
+      bytes[i] = (uint8_t)(occupancy >> (8 * i));
+
+   bytes[24] = (uint8_t)((fen.whiteTurn() ? 0 : 1) | (fen.getCastle() << 1));
+   bytes[25] = (uint8_t)(posEnPassant.isValid() ? posEnPassant.getCol() + 1 : 0);
+   bytes[26] = (uint8_t)(fen.getHalfMoves() > 255 ? 255 : fen.getHalfMoves());
+   bytes[27] = (uint8_t)(fen.getFullMoves() & 0xFF);
+   bytes[28] = (uint8_t)((fen.getFullMoves() >> 8) & 0xFF);
+   return true;
+}
+
+/***********************************************
+ * PACKED POSITION : DECODE
+ * The en passant rank follows from whose turn it is
+ ***********************************************/
+void PackedPosition::decode(Fen& fen) const
+{
+   fen.clear();
+
+   uint64_t occupancy = 0;
+   for (int i = 0; i < 8; i++)
+      occupancy |= (uint64_t)bytes[i] << (8 * i);
+
+   int numPieces = 0;
+   for (int sq = 0; sq < 64; sq++)
+      if (occupancy & ((uint64_t)1 << sq))
+      {
+         int code = (bytes[8 + numPieces / 2] >> (4 * (numPieces & 1))) & 0x0F;
+         fen.set(Position(sq & 7, sq >> 3), (PieceType)(code & 7), code < 8);
+         numPieces++;
+      }
+
+   bool whiteTurn = (bytes[24] & 1) == 0;
+   fen.setWhiteTurn(whiteTurn);
+   fen.setCastle((bytes[24] >> 1) & 0x0F);
+   if (bytes[25])
+      fen.setEnPassant(Position(bytes[25] - 1, whiteTurn ? 5 : 2));
+   fen.setHalfMoves(bytes[26]);
+   fen.setFullMoves(bytes[27] | (bytes[28] << 8));
+}
+
+/***********************************************
+ * PACKED WRITER : CONSTRUCTOR
+ * The file header goes out right away
+ ***********************************************/
+PackedWriter::PackedWriter(ostream& out, int recordsPerBlock) :
+   out(out), recordsPerBlock(recordsPerBlock), numRecords(0),
+   previous(), literalStart(-1), zeroRun(0)
+{
+   assert(recordsPerBlock > 0);
+   out.write(MAGIC, HEADER_SIZE);
+}
+
+/***********************************************
+ * PACKED WRITER : WRITE
+ * Control bytes: 0-127 are 1-128 literals that
+ * follow, 128-255 are runs of 1-128 zeros.
+ ***********************************************/
+void PackedWriter::write(const PackedPosition& position)
+{
+   for (int i = 0; i < PackedPosition::SIZE; i++)
+   {
+      uint8_t delta = position.bytes[i] ^ previous.bytes[i];
+      if (delta == 0)
+      {
+         literalStart = -1;
+         if (++zeroRun == 128)
+         {
+            block.push_back(255);
+            zeroRun = 0;
+         }
+      }
+      else
+      {
+         if (zeroRun)
+         {
+            block.push_back((uint8_t)(127 + zeroRun));
+            zeroRun = 0;
+         }
+         if (literalStart == -1)
+         {
+            literalStart = (int)block.size();
+            block.push_back(0);
+         }
+         else
+            block[literalStart]++;
+         block.push_back(delta);
+         if (block[literalStart] == 127)
+            literalStart = -1;
+      }
+   }
+
+   previous = position;
+   if (++numRecords == recordsPerBlock)
+      flush();
+}
+
+/***********************************************
+ * PACKED WRITER : FLUSH
+ * Close the block. Every block starts from zeros
+ * so each can be decoded on its own.
+ ***********************************************/
+void PackedWriter::flush()
+{
+   if (numRecords == 0)
+      return;
+
+   if (zeroRun)
+      block.push_back((uint8_t)(127 + zeroRun));
+
+   char header[BLOCK_HEADER_SIZE];
+   write32(header, (uint32_t)numRecords);
+   write32(header + 4, (uint32_t)block.size());
+   out.write(header, BLOCK_HEADER_SIZE);
+   out.write((const char*)block.data(), block.size());
+
+   block.clear();
+   numRecords = 0;
+   literalStart = -1;
+   zeroRun = 0;
+   previous = PackedPosition();
+}
+
+/***********************************************
+ * PACKED READER : CONSTRUCTOR
+ ***********************************************/
+PackedReader::PackedReader(const char* begin, const char* end) :
+   p((const uint8_t*)begin), pEnd((const uint8_t*)end),
+   pBlock(nullptr), pBlockEnd(nullptr), numLeft(0),
+   literals(0), zeros(0), previous(), fValid(false)
+{
+   if (end - begin >= HEADER_SIZE && memcmp(begin, MAGIC, HEADER_SIZE) == 0)
+   {
+      fValid = true;
+      p += HEADER_SIZE;
+   }
+   else
+      p = pEnd;
+}
+
+/***********************************************
+ * PACKED READER : NEXT BLOCK
+ ***********************************************/
+bool PackedReader::nextBlock()
+{
+   if (pEnd - p < BLOCK_HEADER_SIZE)
+      return false;
+
+   uint32_t num = read32(p);
+   uint32_t size = read32(p + 4);
+   if ((uint32_t)(pEnd - p - BLOCK_HEADER_SIZE) < size || num == 0)
+   {
+      p = pEnd;
+      return false;
+   }
+
+   pBlock = p + BLOCK_HEADER_SIZE;
+   pBlockEnd = pBlock + size;
+   p = pBlockEnd;
+   numLeft = (int)num;
+   literals = 0;
+   zeros = 0;
+   previous = PackedPosition();
+   return true;
+}
+
+/***********************************************
+ * PACKED READER : NEXT
+ ***********************************************/
+bool PackedReader::next(PackedPosition& position)
+{
+   if (numLeft == 0 && !nextBlock())
+      return false;
+
+   // whole runs at a time rather than byte by byte
+   int i = 0;
+   while (i < PackedPosition::SIZE)
+   {
+      if (zeros == 0 && literals == 0)
+      {
+         if (pBlock >= pBlockEnd)
+            break;
+         uint8_t control = *pBlock++;
+         if (control < 128)
+            literals = control + 1;
+         else
+            zeros = control - 127;
+      }
+
+      int num = PackedPosition::SIZE - i;
+      if (zeros)
+      {
+         num = zeros < num ? zeros : num;
+         memcpy(position.bytes + i, previous.bytes + i, num);
+         zeros -= num;
+      }
+      else
+      {
+         num = literals < num ? literals : num;
+         if (pBlockEnd - pBlock < num)
+            break;
+         for (int j = 0; j < num; j++)
+            position.bytes[i + j] = previous.bytes[i + j] ^ pBlock[j];
+         pBlock += num;
+         literals -= num;
+      }
+      i += num;
+   }
+
+   // a damaged block ends the file
+   if (i < PackedPosition::SIZE)
+   {
+      numLeft = 0;
+      p = pEnd;
+      return false;
+   }
+
+   previous = position;
+   numLeft--;
+   return true;
+}
@@ -0,0 +1,98 @@
+/***********************************************************************
+ * Header File:
+ *    PACKED POSITION
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    A 32 byte binary position and a block-compressed file of them
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include "fen.h"   // what gets packed
+
+class TestPackedPosition;
+
+/***************************************************
+ * PACKED POSITION
+ *    bytes  0-7   occupancy, bit (row * 8 + col) set for each piece
+ *    bytes  8-23  a 4-bit code per occupied square in occupancy order:
+ *                 the PieceType, plus 8 if the piece is black
+ *    byte   24    bit 0 black to move, bits 1-4 castling rights
+ *    byte   25    en passant file + 1, or 0 for none
+ *    byte   26    halfmove clock, at most 255
+ *    bytes 27-28  fullmove number, little endian
+ *    bytes 29-31  zero
+ ***************************************************/
+struct PackedPosition
+{
+   static const int SIZE = 32;
+
+   uint8_t bytes[SIZE];
+
+   // False when the position does not fit: more than 32 pieces, a
+   // fullmove number above 65535, or an en passant square that is
+   // not on the rank the side to move would capture onto.
+   bool encode(const Fen& fen);
+   void decode(Fen& fen) const;
+};
+
+/***************************************************
+ * PACKED WRITER
+ * The file is "PKP1" followed by blocks. A block is a little-endian
+ * record count and byte count, then the records. Each record is
+ * XORed with the one before it, so a position from the same game is
+ * mostly zeros. The zero runs are then squeezed out.
+ ***************************************************/
+class PackedWriter
+{
+   friend TestPackedPosition;
+
+public:
+   PackedWriter(std::ostream& out, int recordsPerBlock = 4096);
+   ~PackedWriter() { flush(); }
+
+   void write(const PackedPosition& position);
+   void flush();
+
+private:
+   std::ostream&        out;
+   int                  recordsPerBlock;
+   int                  numRecords;   // in the current block
+   PackedPosition       previous;     // for the XOR
+   std::vector<uint8_t> block;        // compressed records so far
+   int                  literalStart; // where the open run of literals began, or -1
+   int                  zeroRun;      // zeros not yet written
+};
+
+/***************************************************
+ * PACKED READER
+ * Walk a range of memory, usually a MappedFile, one record at a time
+ ***************************************************/
+class PackedReader
+{
+   friend TestPackedPosition;
+
+public:
+   PackedReader(const char* begin, const char* end);
+   bool isValid() const { return fValid; }
+
+   // false at the end of the data or on a damaged block
+   bool next(PackedPosition& position);
+
+private:
+   bool nextBlock();
+
+   const uint8_t* p;           // the next block
+   const uint8_t* pEnd;        // one past the last byte
+   const uint8_t* pBlock;      // the next compressed byte of this block
+   const uint8_t* pBlockEnd;   // one past the end of this block
+   int            numLeft;     // records left in this block
+   int            literals;    // literal bytes left in the current run
+   int            zeros;       // zero bytes left in the current run
+   PackedPosition previous;    // the last record read
+   bool           fValid;      // did the header check out?
+};
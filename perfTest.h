@@ -0,0 +1,67 @@
+/***********************************************************************
+ * Header File:
+ *    PERF TEST
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Unit tests that assert on speed and heap use
+ ************************************************************************/
+
+#pragma once
+
+#include <sstream>             // for std::ostringstream
+#include "unitTest.h"
+#include "benchmark.h"         // for Benchmark
+#include "allocationCounter.h" // for AllocationCounter
+
+#define assertFaster(expression, nanoseconds) assertFasterParameters([&]() { return expression; }, nanoseconds, #expression, __LINE__, __FUNCTION__)
+#define assertNoAllocations(statement)     assertNoAllocationsParameters([&]() { statement; }, #statement, __LINE__, __FUNCTION__)
+
+/***************************************************
+ * PERF TEST
+ * A UnitTest with two more assertions. Failures are
+ * recorded like assertUnit's and listed by report().
+ ***************************************************/
+class PerfTest : public UnitTest
+{
+protected:
+   /*************************************************************
+    * ASSERT FASTER PARAMETERS
+    * The median time of an expression must be within a budget.
+    * Budgets assume an optimized build, which is why these
+    * tests run from perfRunner() and not testRunner().
+    *************************************************************/
+   template <class Operation>
+   void assertFasterParameters(Operation operation, double nanoseconds,
+                               const char* expressionString,
+                               int line, const char* func)
+   {
+      Benchmark benchmark(expressionString, 2000 /*iterations*/,
+                          11 /*repetitions*/, 1 /*warmups*/);
+      benchmark.run(operation);
+
+      std::ostringstream sout;
+      sout << expressionString << " under " << nanoseconds
+           << " ns (median " << benchmark.getMedian() << " ns)";
+      assertUnitParameters(benchmark.getMedian() <= nanoseconds,
+                           sout.str().c_str(), line, func);
+   }
+
+   /*************************************************************
+    * ASSERT NO ALLOCATIONS PARAMETERS
+    * A statement must not touch the heap
+    *************************************************************/
+   template <class Operation>
+   void assertNoAllocationsParameters(Operation operation,
+                                      const char* statementString,
+                                      int line, const char* func)
+   {
+      AllocationCounter counter;
+      operation();
+      long long count = counter.getCount();
+
+      std::ostringstream sout;
+      sout << statementString << " allocates " << count << " times";
+      assertUnitParameters(count == 0, sout.str().c_str(), line, func);
+   }
+};
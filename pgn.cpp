@@ -0,0 +1,289 @@
+/***********************************************************************
+ * Source File:
+ *    PGN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Walk the games of a Portable Game Notation file in place
+ ************************************************************************/
+
+#include "pgn.h"
+#include <cassert>
+#include <cstring>
+using namespace std;
+
+static bool isSpace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+static bool isDigit(char c) { return c >= '0' && c <= '9'; }
+
+/***********************************************
+ * IS RESULT
+ * The four game termination markers
+ ***********************************************/
+static bool isResult(string_view token)
+{
+   return token == "1-0" || token == "0-1" || token == "1/2-1/2" || token == "*";
+}
+
+/***********************************************
+ * SKIP TO END OF LINE
+ ***********************************************/
+static const char* skipLine(const char* p, const char* end)
+{
+   while (p < end && *p != '\n')
+      p++;
+   return p;
+}
+
+/***********************************************
+ * SKIP COMMENT
+ * p points at '{'. Brace comments do not nest.
+ ***********************************************/
+static const char* skipComment(const char* p, const char* end)
+{
+   while (p < end && *p != '}')
+      p++;
+   return p < end ? p + 1 : p;
+}
+
+/***********************************************
+ * SKIP VARIATION
+ * p points at '('. Variations nest and may hold comments.
+ ***********************************************/
+static const char* skipVariation(const char* p, const char* end)
+{
+   int depth = 0;
+   while (p < end)
+   {
+      if (*p == '{')
+      {
+         p = skipComment(p, end);
+         continue;
+      }
+      if (*p == ';')
+         p = skipLine(p, end);
+      else if (*p == '(')
+         depth++;
+      else if (*p == ')' && --depth == 0)
+         return p + 1;
+      p++;
+   }
+   return p;
+}
+
+/***********************************************
+ * PGN : NEXT TOKEN
+ * The next thing in movetext worth looking at.
+ * A '[' means the movetext ended without a result.
+ ***********************************************/
+Pgn::TokenType Pgn::nextToken(const char*& p, const char* end, string_view& token)
+{
+   while (p < end)
+   {
+      char c = *p;
+      if (isSpace(c) || c == '.')
+         p++;
+      else if (c == '{')
+         p = skipComment(p, end);
+      else if (c == '(')
+         p = skipVariation(p, end);
+      else if (c == ';')
+         p = skipLine(p, end);
+      else if (c == '[')
+         return TOKEN_TAG;
+      else
+      {
+         const char* start = p;
+         while (p < end && !isSpace(*p) && *p != '{' && *p != '(' &&
+                *p != ')' && *p != ';' && *p != '[')
+            p++;
+         token = string_view(start, p - start);
+
+         // NAGs like $1 and stray closing parentheses
+         if (c == '$' || c == ')')
+         {
+            if (p == start)
+               p++;
+            continue;
+         }
+
+         if (isResult(token))
+            return TOKEN_RESULT;
+
+         // move numbers: "12." "12..." or glued on as in "12.e4"
+         size_t i = 0;
+         while (i < token.size() && isDigit(token[i]))
+            i++;
+         if (i > 0 && i < token.size() && token[i] == '.')
+         {
+            while (i < token.size() && token[i] == '.')
+               i++;
+            token.remove_prefix(i);
+         }
+         else if (i == token.size())
+            continue;
+         if (token.empty())
+            continue;
+
+         // annotations: e4!? Nf3!
+         while (!token.empty() && (token.back() == '!' || token.back() == '?'))
+            token.remove_suffix(1);
+         if (token.empty())
+            continue;
+
+         return TOKEN_MOVE;
+      }
+   }
+   return TOKEN_END;
+}
+
+/***********************************************
+ * PGN : NEXT MOVE
+ ***********************************************/
+bool Pgn::nextMove(string_view& movetext, string_view& san)
+{
+   const char* p = movetext.data();
+   const char* end = p + movetext.size();
+   string_view token;
+   TokenType type = nextToken(p, end, token);
+   movetext = string_view(p, end - p);
+   if (type != TOKEN_MOVE)
+      return false;
+   san = token;
+   return true;
+}
+
+/***********************************************
+ * PGN : NEXT
+ * Tag pairs, a blank line, then movetext up to the result.
+ * A segment with neither, such as a comment before the first
+ * game, is skipped rather than taken for the end of the text.
+ ***********************************************/
+bool Pgn::next(Game& game)
+{
+   for (;;)
+   {
+      game.numTags = 0;
+      game.movetext = string_view();
+      game.result = string_view();
+
+      // skip blank lines, a byte order mark, and escape lines
+      while (p < pEnd && (isSpace(*p) || (unsigned char)*p >= 0x80 || *p == '%'))
+         p = (*p == '%') ? skipLine(p, pEnd) : p + 1;
+      if (p >= pEnd)
+         return false;
+
+      // the tag pairs
+      while (p < pEnd && *p == '[')
+      {
+         const char* pLine = skipLine(p, pEnd);
+         const char* q = p + 1;
+         const char* name = q;
+         while (q < pLine && !isSpace(*q) && *q != '"' && *q != ']')
+            q++;
+         const char* nameEnd = q;
+         while (q < pLine && *q != '"')
+            q++;
+         if (q < pLine && game.numTags < MAX_TAGS)
+         {
+            const char* value = ++q;
+            while (q < pLine && *q != '"')
+               q += (*q == '\\' && q + 1 < pLine) ? 2 : 1;
+            game.tags[game.numTags].name = string_view(name, nameEnd - name);
+            game.tags[game.numTags].value = string_view(value, q - value);
+            game.numTags++;
+         }
+
+         p = pLine;
+         while (p < pEnd && isSpace(*p))
+            p++;
+      }
+
+      // the movetext
+      const char* start = p;
+      const char* last = p;
+      string_view token;
+      for (;;)
+      {
+         TokenType type = nextToken(p, pEnd, token);
+         if (type == TOKEN_RESULT)
+         {
+            game.result = token;
+            last = p;
+            break;
+         }
+         if (type != TOKEN_MOVE)
+            break;
+         last = p;
+      }
+      game.movetext = string_view(start, last - start);
+
+      // Without tags p did not start at '[', so nextToken moved it on
+      // to the next '[' or the end: the loop always makes progress.
+      if (game.numTags > 0 || !game.movetext.empty())
+         return true;
+   }
+}
+
+/***********************************************
+ * PGN GAME : GET TAG
+ * The value of a tag, or an empty view
+ ***********************************************/
+string_view Pgn::Game::getTag(string_view name) const
+{
+   for (int i = 0; i < numTags; i++)
+      if (tags[i].name == name)
+         return tags[i].value;
+   return string_view();
+}
+
+/***********************************************
+ * PGN : FIND GAME START
+ * The first '[' at or after p that begins a line
+ * following a blank line: the first tag of a game.
+ ***********************************************/
+const char* Pgn::findGameStart(const char* p, const char* begin, const char* end)
+{
+   while (p < end)
+   {
+      p = (const char*)memchr(p, '[', end - p);
+      if (p == nullptr)
+         return end;
+      if (p == begin)
+         return p;
+
+      if (p[-1] == '\n')
+      {
+         const char* q = p - 2;
+         if (q >= begin && *q == '\r')
+            q--;
+         if (q < begin || *q == '\n')
+            return p;
+      }
+      p++;
+   }
+   return end;
+}
+
+/***********************************************
+ * PGN : SPLIT
+ * Cut at even offsets, then slide each cut
+ * forward to the next game boundary
+ ***********************************************/
+vector<Pgn> Pgn::split(const char* begin, const char* end, int numChunks)
+{
+   assert(numChunks > 0);
+   vector<Pgn> chunks;
+   size_t size = end - begin;
+
+   const char* start = begin;
+   for (int i = 1; i <= numChunks && start < end; i++)
+   {
+      const char* cut = (i == numChunks) ? end :
+         findGameStart(begin + size * i / numChunks, begin, end);
+      if (cut <= start)
+         continue;
+      chunks.push_back(Pgn(start, cut));
+      start = cut;
+   }
+   return chunks;
+}
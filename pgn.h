@@ -0,0 +1,71 @@
+/***********************************************************************
+ * Header File:
+ *    PGN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Walk the games of a Portable Game Notation file in place
+ ************************************************************************/
+
+#pragma once
+
+#include <string_view>
+#include <vector>
+
+class TestPgn;
+
+/***************************************************
+ * PGN
+ * A reader over a range of PGN text, usually a MappedFile. Every tag,
+ * movetext and move handed out is a view into that text, so the text
+ * must outlive the reader and nothing is copied.
+ ***************************************************/
+class Pgn
+{
+   friend TestPgn;
+
+public:
+   static const int MAX_TAGS = 32;
+
+   // [Name "Value"]. The value keeps any \" escapes as written.
+   struct Tag
+   {
+      std::string_view name;
+      std::string_view value;
+   };
+
+   // one game: its tag pairs and its movetext, including the result
+   struct Game
+   {
+      Tag              tags[MAX_TAGS];
+      int              numTags;
+      std::string_view movetext;
+      std::string_view result;
+
+      std::string_view getTag(std::string_view name) const;
+   };
+
+   Pgn(const char* begin, const char* end) : p(begin), pEnd(end) {}
+
+   // read the next game. Returns false at the end of the text.
+   bool next(Game& game);
+
+   // Pop the next move from movetext in standard algebraic notation,
+   // skipping move numbers, comments, variations and annotations.
+   // Returns false at the result or the end of the movetext.
+   static bool nextMove(std::string_view& movetext, std::string_view& san);
+
+   // Cut the text into at most numChunks readers that each start at a
+   // game boundary, so each can be handed to its own thread.
+   static std::vector<Pgn> split(const char* begin, const char* end, int numChunks);
+
+private:
+   enum TokenType { TOKEN_MOVE, TOKEN_RESULT, TOKEN_TAG, TOKEN_END };
+   static TokenType nextToken(const char*& p, const char* end,
+                              std::string_view& token);
+   static const char* findGameStart(const char* p, const char* begin,
+                                    const char* end);
+
+   const char* p;      // where the next game starts
+   const char* pEnd;   // one past the last character
+};
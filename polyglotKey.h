@@ -0,0 +1,17 @@
+/***********************************************************************
+ * Header File:
+ *    POLYGLOT KEY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The Zobrist key Polyglot opening books are sorted by
+ ************************************************************************/
+
+#pragma once
+
+#include <cstdint>
+#include "fen.h"   // the position to hash
+
+// The 64 bit key Book::find and Book::probe look positions up by.
+// The en passant file counts only when a pawn can actually capture.
+uint64_t polyglotKey(const Fen& fen);
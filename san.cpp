@@ -0,0 +1,292 @@
+/***********************************************************************
+ * Source File:
+ *    SAN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Standard algebraic notation: "Nbd7", "exd6 e.p.", "O-O-O", "e8=Q+"
+ ************************************************************************/
+
+#include "san.h"
+#include <cassert>
+using namespace std;
+
+static bool isFile(char c) { return c >= 'a' && c <= 'h'; }
+static bool isRank(char c) { return c >= '1' && c <= '8'; }
+
+/***********************************************
+ * PIECE FROM LETTER
+ * Only the upper case piece letters of SAN
+ ***********************************************/
+static PieceType pieceFromLetter(char letter)
+{
+   switch (letter)
+   {
+   case 'K': return KING;
+   case 'Q': return QUEEN;
+   case 'R': return ROOK;
+   case 'B': return BISHOP;
+   case 'N': return KNIGHT;
+   default:  return INVALID;
+   }
+}
+
+/***********************************************
+ * LETTER FROM PIECE
+ ***********************************************/
+static char letterFromPiece(PieceType pt)
+{
+   static const char letters[] = "??KQRBN?";   // in PieceType order
+   return letters[pt];
+}
+
+/***********************************************
+ * SAN : CLEAR
+ ***********************************************/
+void San::clear()
+{
+   piece = INVALID;
+   dest.setInvalid();
+   fromCol = -1;
+   fromRow = -1;
+   promote = SPACE;
+   moveType = Move::MOVE;
+   fCapture = false;
+   fCheck = false;
+   fMate = false;
+}
+
+/***********************************************
+ * SAN : READ
+ * [piece][from file][from rank][x]dest[=promotion][+|#][!?][ e.p.]
+ ***********************************************/
+bool San::read(string_view text)
+{
+   clear();
+
+   // the suffixes, from the back
+   if (text.size() >= 4 && text.substr(text.size() - 4) == "e.p.")
+   {
+      moveType = Move::ENPASSANT;
+      text.remove_suffix(4);
+      while (!text.empty() && text.back() == ' ')
+         text.remove_suffix(1);
+   }
+   while (!text.empty() && (text.back() == '!' || text.back() == '?'))
+      text.remove_suffix(1);
+   if (!text.empty() && text.back() == '#')
+   {
+      fMate = true;
+      text.remove_suffix(1);
+   }
+   else if (!text.empty() && text.back() == '+')
+   {
+      fCheck = true;
+      text.remove_suffix(1);
+   }
+
+   // castling, with letter O or digit zero
+   if (text == "O-O" || text == "0-0")
+   {
+      piece = KING;
+      moveType = Move::CASTLE_KING;
+      return true;
+   }
+   if (text == "O-O-O" || text == "0-0-0")
+   {
+      piece = KING;
+      moveType = Move::CASTLE_QUEEN;
+      return true;
+   }
+
+   // the moving piece
+   piece = PAWN;
+   if (!text.empty() && pieceFromLetter(text[0]) != INVALID)
+   {
+      piece = pieceFromLetter(text[0]);
+      text.remove_prefix(1);
+   }
+
+   // promotion: e8=Q or e8Q
+   if (text.size() >= 3 && pieceFromLetter(text.back()) != INVALID &&
+       pieceFromLetter(text.back()) != KING)
+   {
+      promote = pieceFromLetter(text.back());
+      text.remove_suffix(1);
+      if (text.back() == '=')
+         text.remove_suffix(1);
+      if (piece != PAWN)
+      {
+         clear();
+         return false;
+      }
+   }
+
+   // the destination is always the last two characters
+   if (text.size() < 2 || !isFile(text[text.size() - 2]) || !isRank(text.back()))
+   {
+      clear();
+      return false;
+   }
+   dest.set(text[text.size() - 2] - 'a', text.back() - '1');
+   text.remove_suffix(2);
+
+   // what remains: [from file][from rank][x]
+   if (!text.empty() && text.back() == 'x')
+   {
+      fCapture = true;
+      text.remove_suffix(1);
+   }
+   if (!text.empty() && isFile(text[0]))
+   {
+      fromCol = text[0] - 'a';
+      text.remove_prefix(1);
+   }
+   if (!text.empty() && isRank(text[0]))
+   {
+      fromRow = text[0] - '1';
+      text.remove_prefix(1);
+   }
+
+   // a pawn capture names its file and nothing else; a push names nothing
+   bool valid = text.empty();
+   if (piece == PAWN)
+      valid = valid && fromRow == -1 && fCapture == (fromCol != -1);
+   if (moveType == Move::ENPASSANT)
+      valid = valid && piece == PAWN && fCapture;
+
+   if (!valid)
+      clear();
+   return valid;
+}
+
+/***********************************************
+ * SAN : WRITE
+ ***********************************************/
+int San::write(char* buffer) const
+{
+   assert(buffer);
+   char* p = buffer;
+
+   if (moveType == Move::CASTLE_KING || moveType == Move::CASTLE_QUEEN)
+   {
+      *p++ = 'O'; *p++ = '-'; *p++ = 'O';
+      if (moveType == Move::CASTLE_QUEEN)
+      {
+         *p++ = '-'; *p++ = 'O';
+      }
+   }
+   else
+   {
+      if (piece != PAWN)
+         *p++ = letterFromPiece(piece);
+      if (fromCol != -1)
+         *p++ = (char)('a' + fromCol);
+      if (fromRow != -1)
+         *p++ = (char)('1' + fromRow);
+      if (fCapture)
+         *p++ = 'x';
+      *p++ = (char)('a' + dest.getCol());
+      *p++ = (char)('1' + dest.getRow());
+      if (promote != SPACE)
+      {
+         *p++ = '=';
+         *p++ = letterFromPiece(promote);
+      }
+   }
+
+   if (fMate)
+      *p++ = '#';
+   else if (fCheck)
+      *p++ = '+';
+   *p = '\0';
+
+   assert(p - buffer < MAX_LENGTH);
+   return (int)(p - buffer);
+}
+
+/***********************************************
+ * SAN : GET TEXT
+ ***********************************************/
+string San::getText() const
+{
+   char buffer[MAX_LENGTH];
+   int length = write(buffer);
+   return string(buffer, length);
+}
+
+/***********************************************
+ * SAN : FROM MOVE
+ * Minimal disambiguation: the file if that is enough,
+ * else the rank if that is enough, else both.
+ ***********************************************/
+San San::fromMove(const Move& move, PieceType piece,
+                  const Position* rivals, int numRivals,
+                  bool check, bool mate)
+{
+   San san;
+   san.piece = piece;
+   san.moveType = move.getMoveType();
+   san.fCheck = check;
+   san.fMate = mate;
+   if (san.moveType == Move::CASTLE_KING || san.moveType == Move::CASTLE_QUEEN)
+      return san;
+
+   const Position& source = move.getSource();
+   san.dest = move.getDest();
+   san.promote = move.getPromote();
+   san.fCapture = move.getCapture() != SPACE || san.moveType == Move::ENPASSANT;
+
+   // en passant is only marked by the capture
+   if (san.moveType == Move::ENPASSANT)
+      san.moveType = Move::MOVE;
+
+   if (piece == PAWN)
+   {
+      if (san.fCapture)
+         san.fromCol = source.getCol();
+      return san;
+   }
+
+   bool sameCol = false;
+   bool sameRow = false;
+   for (int i = 0; i < numRivals; i++)
+   {
+      sameCol |= rivals[i].getCol() == source.getCol();
+      sameRow |= rivals[i].getRow() == source.getRow();
+   }
+   if (numRivals > 0)
+   {
+      if (!sameCol)
+         san.fromCol = source.getCol();
+      else if (!sameRow)
+         san.fromRow = source.getRow();
+      else
+      {
+         san.fromCol = source.getCol();
+         san.fromRow = source.getRow();
+      }
+   }
+   return san;
+}
+
+/***********************************************
+ * SAN : MATCHES
+ * Compare fields; a pawn capture matches an
+ * en passant move whether or not "e.p." was written.
+ ***********************************************/
+bool San::matches(const Move& move, PieceType pieceOnSource) const
+{
+   if (moveType == Move::CASTLE_KING || moveType == Move::CASTLE_QUEEN)
+      return move.getMoveType() == moveType;
+   if (move.getMoveType() == Move::CASTLE_KING ||
+       move.getMoveType() == Move::CASTLE_QUEEN)
+      return false;
+
+   return pieceOnSource == piece &&
+          move.getDest() == dest &&
+          move.getPromote() == promote &&
+          (fromCol == -1 || move.getSource().getCol() == fromCol) &&
+          (fromRow == -1 || move.getSource().getRow() == fromRow) &&
+          (moveType != Move::ENPASSANT || move.getMoveType() == Move::ENPASSANT);
+}
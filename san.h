@@ -0,0 +1,77 @@
+/***********************************************************************
+ * Header File:
+ *    SAN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Standard algebraic notation: "Nbd7", "exd6 e.p.", "O-O-O", "e8=Q+"
+ ************************************************************************/
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include "move.h"        // SAN is resolved to and generated from a Move
+#include "pieceType.h"
+
+class TestSan;
+
+/***************************************************
+ * SAN
+ * One move as written in standard algebraic notation, split into
+ * its parts. Parsing never looks at a board: a SAN is resolved by
+ * testing each candidate move with matches(), so nothing has to be
+ * turned back into text to find the move that was meant.
+ ***************************************************/
+class San
+{
+   friend TestSan;
+
+public:
+   // the longest SAN, "Qh4xe1=Q+" is nine, plus room for " e.p."
+   static const int MAX_LENGTH = 16;
+
+   San() { clear(); }
+
+   // Parse. On failure the San is cleared and false is returned.
+   bool read(std::string_view text);
+
+   // Write into a buffer of at least MAX_LENGTH. Returns the length.
+   int write(char* buffer) const;
+   std::string getText() const;
+
+   // Build the SAN for a move. rivals are the squares of other pieces of
+   // the same type and color that can also legally move to the same
+   // destination; they decide how much disambiguation is needed.
+   static San fromMove(const Move& move, PieceType piece,
+                       const Position* rivals, int numRivals,
+                       bool check = false, bool mate = false);
+
+   // Is this the move the SAN describes? piece is what stands on the
+   // move's source square.
+   bool matches(const Move& move, PieceType piece) const;
+
+   // getters
+   PieceType      getPiece()    const { return piece;    }
+   Position       getDest()     const { return dest;     }
+   int            getFromCol()  const { return fromCol;  }
+   int            getFromRow()  const { return fromRow;  }
+   PieceType      getPromote()  const { return promote;  }
+   Move::MoveType getMoveType() const { return moveType; }
+   bool           isCapture()   const { return fCapture; }
+   bool           isCheck()     const { return fCheck;   }
+   bool           isMate()      const { return fMate;    }
+
+   void clear();
+
+private:
+   PieceType      piece;      // the piece that moves
+   Position       dest;       // where it goes, invalid when castling
+   int            fromCol;    // disambiguating file 0-7, or -1
+   int            fromRow;    // disambiguating rank 0-7, or -1
+   PieceType      promote;    // SPACE when not a promotion
+   Move::MoveType moveType;   // MOVE, ENPASSANT (only when "e.p." is written), or a castle
+   bool           fCapture;   // "x"
+   bool           fCheck;     // "+"
+   bool           fMate;      // "#"
+};
@@ -11,6 +11,17 @@
 #include "testPosition.h"
 #include "testBoard.h"
 #include "testMove.h"
+#include "testBitbase.h"
+#include "testBook.h"
+#include "testPolyglotKey.h"
+#include "testFen.h"
+#include "testPgn.h"
+#include "testSan.h"
+#include "testGameRecord.h"
+#include "testPackedPosition.h"
+#include "testHistory.h"
+#include "testBenchmark.h"
+#include "testPerformance.h"
 
 
 #include "piece.h"        // for PIECE and company
@@ -26,4 +37,25 @@ void testRunner()
    PositionTest().run();
    TestMove().run();
    TestBoard().run();
+   TestBitbase().run();
+   TestBook().run();
+   TestPolyglotKey().run();
+   TestFen().run();
+   TestPgn().run();
+   TestSan().run();
+   TestGameRecord().run();
+   TestPackedPosition().run();
+   TestHistory().run();
+   TestBenchmark().run();
+}
+
+/*****************************************************************
+ * PERF RUNNER
+ * Runs the performance tests. They measure wall-clock time, so
+ * they are kept out of testRunner(): a debug, sanitizer, or busy
+ * build would fail them for reasons that are not regressions.
+ ****************************************************************/
+void perfRunner()
+{
+   TestPerformance().run();
 }
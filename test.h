@@ -10,3 +10,6 @@
 #pragma once
 
 void testRunner();
+
+// the time budgets and heap checks; run them on an optimized build
+void perfRunner();
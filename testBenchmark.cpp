@@ -0,0 +1,177 @@
+/***********************************************************************
+ * Source File:
+ *    TEST BENCHMARK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the benchmark statistics
+ ************************************************************************/
+
+#include "testBenchmark.h"
+#include "benchmark.h"
+#include <sstream>
+
+/*************************************
+ * PERCENTILE : nothing has been run
+ **************************************/
+void TestBenchmark::percentile_empty()
+{  // SETUP
+   Benchmark benchmark("empty");
+   // EXERCISE
+   double median = benchmark.getMedian();
+   // VERIFY
+   assertUnit(median == 0.0);
+}  // TEARDOWN
+
+/*************************************
+ * PERCENTILE : one sample is every percentile
+ **************************************/
+void TestBenchmark::percentile_single()
+{  // SETUP
+   Benchmark benchmark("single");
+   benchmark.samples = { 7.0 };
+   // EXERCISE / VERIFY
+   assertUnit(benchmark.getPercentile(0.0)   == 7.0);
+   assertUnit(benchmark.getPercentile(50.0)  == 7.0);
+   assertUnit(benchmark.getPercentile(100.0) == 7.0);
+}  // TEARDOWN
+
+/*************************************
+ * PERCENTILE : lands exactly on a sample
+ *    0 10 20 30 40 : 25% is the second
+ **************************************/
+void TestBenchmark::percentile_exact()
+{  // SETUP
+   Benchmark benchmark("exact");
+   benchmark.samples = { 0.0, 10.0, 20.0, 30.0, 40.0 };
+   // EXERCISE
+   double p25 = benchmark.getPercentile(25.0);
+   double p75 = benchmark.getPercentile(75.0);
+   // VERIFY
+   assertUnit(p25 == 10.0);
+   assertUnit(p75 == 30.0);
+}  // TEARDOWN
+
+/*************************************
+ * PERCENTILE : between two samples
+ *    0 10 20 30 40 : 10% is 0.4 of the way to 10
+ **************************************/
+void TestBenchmark::percentile_interpolate()
+{  // SETUP
+   Benchmark benchmark("interpolate");
+   benchmark.samples = { 0.0, 10.0, 20.0, 30.0, 40.0 };
+   // EXERCISE
+   double p10 = benchmark.getPercentile(10.0);
+   double p90 = benchmark.getPercentile(90.0);
+   // VERIFY
+   assertUnit(p10 > 3.999 && p10 < 4.001);
+   assertUnit(p90 > 35.999 && p90 < 36.001);
+}  // TEARDOWN
+
+/*************************************
+ * MEDIAN : odd number of samples
+ **************************************/
+void TestBenchmark::median_odd()
+{  // SETUP
+   Benchmark benchmark("odd");
+   benchmark.samples = { 1.0, 2.0, 100.0 };
+   // EXERCISE
+   double median = benchmark.getMedian();
+   // VERIFY
+   assertUnit(median == 2.0);
+}  // TEARDOWN
+
+/*************************************
+ * MEDIAN : even number of samples
+ **************************************/
+void TestBenchmark::median_even()
+{  // SETUP
+   Benchmark benchmark("even");
+   benchmark.samples = { 1.0, 2.0, 4.0, 100.0 };
+   // EXERCISE
+   double median = benchmark.getMedian();
+   // VERIFY
+   assertUnit(median == 3.0);
+}  // TEARDOWN
+
+/*************************************
+ * MIN MAX : the ends of the samples
+ **************************************/
+void TestBenchmark::minMax()
+{  // SETUP
+   Benchmark benchmark("minMax");
+   benchmark.samples = { 1.5, 2.0, 4.0, 9.5 };
+   // EXERCISE / VERIFY
+   assertUnit(benchmark.getMin() == 1.5);
+   assertUnit(benchmark.getMax() == 9.5);
+}  // TEARDOWN
+
+/*************************************
+ * RUN : warm-ups and repetitions all call the operation
+ **************************************/
+void TestBenchmark::run_countsCalls()
+{  // SETUP
+   Benchmark benchmark("count", 10 /*iterations*/, 5 /*repetitions*/, 2 /*warmups*/);
+   int calls = 0;
+   // EXERCISE
+   benchmark.run([&]() { return ++calls; });
+   // VERIFY
+   assertUnit(calls == 10 * (5 + 2));
+   assertUnit(benchmark.samples.size() == 5);
+}  // TEARDOWN
+
+/*************************************
+ * RUN : the samples come back sorted
+ **************************************/
+void TestBenchmark::run_sorted()
+{  // SETUP
+   Benchmark benchmark("sorted", 100, 9, 1);
+   int calls = 0;
+   // EXERCISE
+   benchmark.run([&]() { return calls++ * 3; });
+   // VERIFY
+   bool sorted = true;
+   for (size_t i = 1; i < benchmark.samples.size(); i++)
+      if (benchmark.samples[i - 1] > benchmark.samples[i])
+         sorted = false;
+   assertUnit(sorted);
+   assertUnit(benchmark.getMin() >= 0.0);
+   assertUnit(benchmark.getMin() <= benchmark.getMedian());
+   assertUnit(benchmark.getMedian() <= benchmark.getMax());
+}  // TEARDOWN
+
+/*************************************
+ * REPORT : the caller's stream formatting is unchanged
+ **************************************/
+void TestBenchmark::report_keepsFormat()
+{  // SETUP
+   Benchmark benchmark("format");
+   benchmark.samples = { 1.0, 2.0, 3.0 };
+   std::ostringstream sout;
+   std::ios::fmtflags flags = sout.flags();
+   std::streamsize precision = sout.precision();
+   // EXERCISE
+   benchmark.report(sout);
+   // VERIFY
+   assertUnit(sout.flags() == flags);
+   assertUnit(sout.precision() == precision);
+   assertUnit(sout.str().find("2.00 ns") != std::string::npos);
+}  // TEARDOWN
+
+/*************************************
+ * REPORT JSON : the caller's stream formatting is unchanged
+ **************************************/
+void TestBenchmark::reportJSON_keepsFormat()
+{  // SETUP
+   Benchmark benchmark("format");
+   benchmark.samples = { 1.0, 2.0, 3.0 };
+   std::ostringstream sout;
+   std::ios::fmtflags flags = sout.flags();
+   std::streamsize precision = sout.precision();
+   // EXERCISE
+   benchmark.reportJSON(sout);
+   // VERIFY
+   assertUnit(sout.flags() == flags);
+   assertUnit(sout.precision() == precision);
+   assertUnit(sout.str().find("\"median_ns\": 2.000") != std::string::npos);
+}  // TEARDOWN
@@ -0,0 +1,49 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BENCHMARK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the benchmark statistics
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * BENCHMARK TEST
+ * Test the Benchmark class
+ ***************************************************/
+class TestBenchmark : public UnitTest
+{
+public:
+   void run()
+   {
+      percentile_empty();
+      percentile_single();
+      percentile_exact();
+      percentile_interpolate();
+      median_odd();
+      median_even();
+      minMax();
+      run_countsCalls();
+      run_sorted();
+      report_keepsFormat();
+      reportJSON_keepsFormat();
+
+      report("Benchmark");
+   }
+private:
+   void percentile_empty();
+   void percentile_single();
+   void percentile_exact();
+   void percentile_interpolate();
+   void median_odd();
+   void median_even();
+   void minMax();
+   void run_countsCalls();
+   void run_sorted();
+   void report_keepsFormat();
+   void reportJSON_keepsFormat();
+};
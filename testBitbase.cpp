@@ -0,0 +1,245 @@
+/***********************************************************************
+ * Source File:
+ *    TEST BITBASE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the KPK bitbase
+ ************************************************************************/
+
+#include "testBitbase.h"
+#include "bitbase.h"
+#include "position.h"
+
+
+/***********************************************
+ * PROBE KPK : king on the sixth rank, white to move
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8          k          8
+ * 7                     7
+ * 6          K          6
+ * 5          P          5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_kingSixthRankWhite()
+{  // SETUP
+   Position posKing("e6");
+   Position posPawn("e5");
+   Position posKingWeak("e8");
+   bool win = false;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == true);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : king on the sixth rank, black to move
+ * Same position as above: the opposition does not matter
+ ***********************************************/
+void TestBitbase::probeKPK_kingSixthRankBlack()
+{  // SETUP
+   Position posKing("e6");
+   Position posPawn("e5");
+   Position posKingWeak("e8");
+   bool win = false;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, false /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == true);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : king on the sixth rank on the h-side
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8            k        8
+ * 7                     7
+ * 6            K        6
+ * 5            P        5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_kingSixthRankMirror()
+{  // SETUP
+   Position posKing("f6");
+   Position posPawn("f5");
+   Position posKingWeak("f8");
+   bool win = false;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, false /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == true);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : the pawn outruns the king
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6          P          6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1  k              K   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_pawnRuns()
+{  // SETUP
+   Position posKing("h1");
+   Position posPawn("e6");
+   Position posKingWeak("a1");
+   bool win = false;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == true);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : black takes the undefended pawn
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5        k            5
+ * 4          P          4
+ * 3                     3
+ * 2                     2
+ * 1                 K   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_pawnCaptured()
+{  // SETUP
+   Position posKing("h1");
+   Position posPawn("e4");
+   Position posKingWeak("d5");
+   bool win = true;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, false /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == false);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : black king blocks, white king too far
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5          k          5
+ * 4          P          4
+ * 3                     3
+ * 2                     2
+ * 1          K          1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_pawnBlocked()
+{  // SETUP
+   Position posKing("e1");
+   Position posPawn("e4");
+   Position posKingWeak("e5");
+   bool win = true;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == false);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : rook pawn with the king in the corner
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8  k                  8
+ * 7                     7
+ * 6                     6
+ * 5  P                  5
+ * 4    K                4
+ * 3                     3
+ * 2                     2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_rookPawn()
+{  // SETUP
+   Position posKing("b4");
+   Position posPawn("a5");
+   Position posKingWeak("a8");
+   bool win = true;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == false);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : kings touching is not a position
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8                     8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4          k          4
+ * 3          K          3
+ * 2          P          2
+ * 1                     1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_invalid()
+{  // SETUP
+   Position posKing("e3");
+   Position posPawn("e2");
+   Position posKingWeak("e4");
+   bool win = true;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == false);
+}  // TEARDOWN
+
+/***********************************************
+ * PROBE KPK : a pawn on the last rank is not in the table
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8          P          8
+ * 7                     7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2                     2
+ * 1  K              k   1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ ***********************************************/
+void TestBitbase::probeKPK_pawnLastRank()
+{  // SETUP
+   Position posKing("a1");
+   Position posPawn("e8");
+   Position posKingWeak("h1");
+   bool win = true;
+   // EXERCISE
+   win = Bitbase::probeKPK(posKing, posPawn, posKingWeak, true /*strongToMove*/);
+   // VERIFY
+   assertUnit(win == false);
+}  // TEARDOWN
@@ -0,0 +1,45 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BITBASE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the KPK bitbase
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * BITBASE TEST
+ * Test the Bitbase class
+ ***************************************************/
+class TestBitbase : public UnitTest
+{
+public:
+   void run()
+   {
+      probeKPK_kingSixthRankWhite();
+      probeKPK_kingSixthRankBlack();
+      probeKPK_kingSixthRankMirror();
+      probeKPK_pawnRuns();
+      probeKPK_pawnCaptured();
+      probeKPK_pawnBlocked();
+      probeKPK_rookPawn();
+      probeKPK_invalid();
+      probeKPK_pawnLastRank();
+
+      report("Bitbase");
+   }
+private:
+   void probeKPK_kingSixthRankWhite();
+   void probeKPK_kingSixthRankBlack();
+   void probeKPK_kingSixthRankMirror();
+   void probeKPK_pawnRuns();
+   void probeKPK_pawnCaptured();
+   void probeKPK_pawnBlocked();
+   void probeKPK_rookPawn();
+   void probeKPK_invalid();
+   void probeKPK_pawnLastRank();
+};
@@ -0,0 +1,342 @@
+/***********************************************************************
+ * Source File:
+ *    TEST BOOK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the Polyglot opening book
+ ************************************************************************/
+
+#include "testBook.h"
+#include "book.h"
+#include "fen.h"
+#include "polyglotKey.h"
+#include <cstdio>
+#include <fstream>
+
+static const char* FILENAME = "testBook.bin";
+
+/***********************************************
+ * POLYGLOT
+ * Encode "e2e4" the way Polyglot does
+ ***********************************************/
+uint16_t TestBook::polyglot(const char* text, int promote)
+{
+   return (uint16_t)((text[2] - 'a')       | ((text[3] - '1') << 3) |
+                     ((text[0] - 'a') << 6) | ((text[1] - '1') << 9) |
+                     (promote << 12));
+}
+
+/***********************************************
+ * WRITE ENTRY
+ * One 16 byte big-endian entry, learn left at zero
+ ***********************************************/
+void TestBook::writeEntry(std::ostream& out, uint64_t key,
+                          const char* move, uint16_t weight)
+{
+   unsigned char bytes[16] = {};
+   for (int i = 0; i < 8; i++)
+      bytes[i] = (unsigned char)(key >> (56 - 8 * i));
+   uint16_t polyglotMove = polyglot(move, 0);
+   bytes[8]  = (unsigned char)(polyglotMove >> 8);
+   bytes[9]  = (unsigned char)(polyglotMove);
+   bytes[10] = (unsigned char)(weight >> 8);
+   bytes[11] = (unsigned char)(weight);
+   out.write((const char*)bytes, sizeof(bytes));
+}
+
+/***********************************************
+ * WRITE BOOK
+ * Four entries sorted by key:
+ *    0x10 e2e4 (weight 5)
+ *    0x20 d2d4 (weight 1)
+ *    0x20 c2c4 (weight 9)
+ *    0x30 g1f3 (weight 2)
+ ***********************************************/
+void TestBook::writeBook(const char* filename)
+{
+   std::ofstream fout(filename, std::ios::binary);
+   writeEntry(fout, 0x10, "e2e4", 5);
+   writeEntry(fout, 0x20, "d2d4", 1);
+   writeEntry(fout, 0x20, "c2c4", 9);
+   writeEntry(fout, 0x30, "g1f3", 2);
+}
+
+/*************************************
+ * MOVE FROM POLYGLOT : simple move
+ * Input:  e2e4
+ * Output: source=e2 dest=e4 type=MOVE
+ **************************************/
+void TestBook::moveFromPolyglot_simple()
+{  // SETUP
+   uint16_t move = polyglot("e2e4", 0);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getSource() == Position("e2"));
+   assertUnit(result.getDest() == Position("e4"));
+   assertUnit(result.getMoveType() == Move::MOVE);
+   assertUnit(result.getPromote() == SPACE);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : promotion
+ * Input:  b7b8 promote=1 (knight)
+ * Output: source=b7 dest=b8 promote=KNIGHT
+ **************************************/
+void TestBook::moveFromPolyglot_promote()
+{  // SETUP
+   uint16_t move = polyglot("b7b8", 1);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getSource() == Position("b7"));
+   assertUnit(result.getDest() == Position("b8"));
+   assertUnit(result.getPromote() == KNIGHT);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : king side castle
+ * Input:  e1h1
+ * Output: source=e1 dest=g1 type=CASTLE_KING
+ **************************************/
+void TestBook::moveFromPolyglot_castleKing()
+{  // SETUP
+   uint16_t move = polyglot("e1h1", 0);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getSource() == Position("e1"));
+   assertUnit(result.getDest() == Position("g1"));
+   assertUnit(result.getMoveType() == Move::CASTLE_KING);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : queen side castle
+ * Input:  e8a8
+ * Output: source=e8 dest=c8 type=CASTLE_QUEEN
+ **************************************/
+void TestBook::moveFromPolyglot_castleQueen()
+{  // SETUP
+   uint16_t move = polyglot("e8a8", 0);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getSource() == Position("e8"));
+   assertUnit(result.getDest() == Position("c8"));
+   assertUnit(result.getMoveType() == Move::CASTLE_QUEEN);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : black castles
+ * Input:  e8h8
+ * Output: equal to the black Move for e8g8c
+ **************************************/
+void TestBook::moveFromPolyglot_castleBlack()
+{  // SETUP
+   uint16_t move = polyglot("e8h8", 0);
+   Move expected;
+   expected.readFromString("e8g8c");
+   expected.setWhite(false);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getWhite() == false);
+   assertUnit(result == expected);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : black promotes
+ * Input:  a2a1 promote=4 (queen)
+ * Output: a black move
+ **************************************/
+void TestBook::moveFromPolyglot_promoteBlack()
+{  // SETUP
+   uint16_t move = polyglot("a2a1", 4);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getPromote() == QUEEN);
+   assertUnit(result.getWhite() == false);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE FROM POLYGLOT : king step along the back rank
+ * Input:  e1f1
+ * Output: source=e1 dest=f1 type=MOVE
+ **************************************/
+void TestBook::moveFromPolyglot_notCastle()
+{  // SETUP
+   uint16_t move = polyglot("e1f1", 0);
+   // EXERCISE
+   Move result = Book::moveFromPolyglot(move);
+   // VERIFY
+   assertUnit(result.getDest() == Position("f1"));
+   assertUnit(result.getMoveType() == Move::MOVE);
+}  // TEARDOWN
+
+/*************************************
+ * OPEN : the file does not exist
+ **************************************/
+void TestBook::open_missing()
+{  // SETUP
+   Book book;
+   // EXERCISE
+   bool opened = book.open("noSuchBook.bin");
+   // VERIFY
+   assertUnit(opened == false);
+   assertUnit(book.isOpen() == false);
+}  // TEARDOWN
+
+/*************************************
+ * OPEN : the file is not a whole number of entries
+ **************************************/
+void TestBook::open_partialEntry()
+{  // SETUP
+   {
+      std::ofstream fout(FILENAME, std::ios::binary);
+      fout.write("0123456789", 10);
+   }
+   Book book;
+   // EXERCISE
+   bool opened = book.open(FILENAME);
+   // VERIFY
+   assertUnit(opened == false);
+   assertUnit(book.isOpen() == false);
+   // TEARDOWN
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * FIND : two entries share a key
+ * Input:  key=0x20
+ * Output: d2d4 and c2c4 in file order
+ **************************************/
+void TestBook::find_multiple()
+{  // SETUP
+   writeBook(FILENAME);
+   Book book;
+   book.open(FILENAME);
+   Book::Entry entries[8];
+   // EXERCISE
+   int num = book.find(0x20, entries, 8);
+   // VERIFY
+   assertUnit(book.size() == 4);
+   assertUnit(num == 2);
+   assertUnit(entries[0].move == polyglot("d2d4", 0));
+   assertUnit(entries[0].weight == 1);
+   assertUnit(entries[1].move == polyglot("c2c4", 0));
+   assertUnit(entries[1].weight == 9);
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * FIND : the key falls between two entries
+ * Input:  key=0x18
+ * Output: nothing
+ **************************************/
+void TestBook::find_missing()
+{  // SETUP
+   writeBook(FILENAME);
+   Book book;
+   book.open(FILENAME);
+   Book::Entry entries[8];
+   // EXERCISE
+   int num = book.find(0x18, entries, 8);
+   // VERIFY
+   assertUnit(num == 0);
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * PROBE : the heaviest move wins
+ * Input:  key=0x20
+ * Output: c2c4
+ **************************************/
+void TestBook::probe_bestWeight()
+{  // SETUP
+   writeBook(FILENAME);
+   Book book;
+   book.open(FILENAME);
+   // EXERCISE
+   Move move = book.probe(0x20);
+   // VERIFY
+   assertUnit(move.getSource() == Position("c2"));
+   assertUnit(move.getDest() == Position("c4"));
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * PROBE : past the last entry
+ * Input:  key=0x40
+ * Output: a move with an invalid source
+ **************************************/
+void TestBook::probe_missing()
+{  // SETUP
+   writeBook(FILENAME);
+   Book book;
+   book.open(FILENAME);
+   // EXERCISE
+   Move move = book.probe(0x40);
+   // VERIFY
+   assertUnit(move.getSource().isInvalid());
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * PROBE : more entries for a key than any buffer
+ * Input:  40 entries for key 0x10, the heaviest near the end
+ * Output: that heaviest move
+ **************************************/
+void TestBook::probe_manyEntries()
+{  // SETUP
+   {
+      std::ofstream fout(FILENAME, std::ios::binary);
+      for (int i = 0; i < 40; i++)
+         writeEntry(fout, 0x10, i == 37 ? "g1f3" : "a2a3", (uint16_t)(i == 37 ? 100 : i));
+   }
+   Book book;
+   book.open(FILENAME);
+   // EXERCISE
+   Move move = book.probe(0x10);
+   // VERIFY
+   assertUnit(move.getSource() == Position("g1"));
+   assertUnit(move.getDest() == Position("f3"));
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
+
+/*************************************
+ * PROBE : from a FEN through its Polyglot key
+ * Input:  the starting position, in a book with e2e4 and d2d4
+ * Output: e2e4, the heavier of the two
+ **************************************/
+void TestBook::probe_fromFen()
+{  // SETUP
+   {
+      std::ofstream fout(FILENAME, std::ios::binary);
+      writeEntry(fout, 0x463B96181691FC9CULL, "d2d4", 5);
+      writeEntry(fout, 0x463B96181691FC9CULL, "e2e4", 10);
+   }
+   Book book;
+   book.open(FILENAME);
+   Fen fen;
+   fen.read("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   // EXERCISE
+   Move move = book.probe(polyglotKey(fen));
+   // VERIFY
+   assertUnit(move.getSource() == Position("e2"));
+   assertUnit(move.getDest() == Position("e4"));
+   // TEARDOWN
+   book.close();
+   std::remove(FILENAME);
+}
@@ -0,0 +1,64 @@
+/***********************************************************************
+ * Header File:
+ *    TEST BOOK
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the Polyglot opening book
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+#include <cstdint>
+#include <ostream>
+
+/***************************************************
+ * BOOK TEST
+ * Test the Book class
+ ***************************************************/
+class TestBook : public UnitTest
+{
+public:
+   void run()
+   {
+      moveFromPolyglot_simple();
+      moveFromPolyglot_promote();
+      moveFromPolyglot_castleKing();
+      moveFromPolyglot_castleQueen();
+      moveFromPolyglot_castleBlack();
+      moveFromPolyglot_promoteBlack();
+      moveFromPolyglot_notCastle();
+      open_missing();
+      open_partialEntry();
+      find_multiple();
+      find_missing();
+      probe_bestWeight();
+      probe_missing();
+      probe_manyEntries();
+      probe_fromFen();
+
+      report("Book");
+   }
+private:
+   void moveFromPolyglot_simple();
+   void moveFromPolyglot_promote();
+   void moveFromPolyglot_castleKing();
+   void moveFromPolyglot_castleQueen();
+   void moveFromPolyglot_castleBlack();
+   void moveFromPolyglot_promoteBlack();
+   void moveFromPolyglot_notCastle();
+   void open_missing();
+   void open_partialEntry();
+   void find_multiple();
+   void find_missing();
+   void probe_bestWeight();
+   void probe_missing();
+   void probe_manyEntries();
+   void probe_fromFen();
+
+   static uint16_t polyglot(const char* text, int promote);
+   static void writeEntry(std::ostream& out, uint64_t key,
+                          const char* move, uint16_t weight);
+   static void writeBook(const char* filename);
+};
@@ -0,0 +1,300 @@
+/***********************************************************************
+ * Source File:
+ *    TEST FEN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for reading and writing FEN
+ ************************************************************************/
+
+#include "testFen.h"
+#include "fen.h"
+#include <cstring>
+
+static const char* START =
+   "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
+/*************************************
+ * CONSTRUCTOR : default
+ * Output: empty board, white to move, move 1
+ **************************************/
+void TestFen::construct_default()
+{  // SETUP
+   // EXERCISE
+   Fen fen;
+   // VERIFY
+   assertUnit(fen.type[0][0] == SPACE);
+   assertUnit(fen.type[7][7] == SPACE);
+   assertUnit(fen.fWhiteTurn == true);
+   assertUnit(fen.castle == 0);
+   assertUnit(fen.enPassant.isInvalid());
+   assertUnit(fen.halfMoves == 0);
+   assertUnit(fen.fullMoves == 1);
+}  // TEARDOWN
+
+/*************************************
+ * READ : the starting position
+ * +---a-b-c-d-e-f-g-h---+
+ * |                     |
+ * 8  r n b q k b n r    8
+ * 7  p p p p p p p p    7
+ * 6                     6
+ * 5                     5
+ * 4                     4
+ * 3                     3
+ * 2  P P P P P P P P    2
+ * 1  R N B Q K B N R    1
+ * |                     |
+ * +---a-b-c-d-e-f-g-h---+
+ **************************************/
+void TestFen::read_start()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read(START);
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(fen.type[0][0] == ROOK);
+   assertUnit(fen.fWhite[0][0] == true);
+   assertUnit(fen.type[4][0] == KING);
+   assertUnit(fen.type[3][7] == QUEEN);
+   assertUnit(fen.fWhite[3][7] == false);
+   assertUnit(fen.type[6][7] == KNIGHT);
+   assertUnit(fen.type[5][0] == BISHOP);
+   assertUnit(fen.type[4][1] == PAWN);
+   assertUnit(fen.fWhite[4][1] == true);
+   assertUnit(fen.type[4][6] == PAWN);
+   assertUnit(fen.fWhite[4][6] == false);
+   assertUnit(fen.type[4][4] == SPACE);
+   assertUnit(fen.fWhiteTurn == true);
+   assertUnit(fen.castle == (Fen::CASTLE_WHITE_KING | Fen::CASTLE_WHITE_QUEEN |
+                             Fen::CASTLE_BLACK_KING | Fen::CASTLE_BLACK_QUEEN));
+   assertUnit(fen.enPassant.isInvalid());
+   assertUnit(fen.halfMoves == 0);
+   assertUnit(fen.fullMoves == 1);
+}  // TEARDOWN
+
+/*************************************
+ * READ : after 1. e4
+ * Input:  ... b KQkq e3 0 1
+ * Output: black to move, en passant e3
+ **************************************/
+void TestFen::read_enPassant()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read(
+      "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(fen.type[4][3] == PAWN);
+   assertUnit(fen.type[4][1] == SPACE);
+   assertUnit(fen.fWhiteTurn == false);
+   assertUnit(fen.enPassant == Position("e3"));
+}  // TEARDOWN
+
+/*************************************
+ * READ : no castling, counters in the middle of a game
+ * Input:  8/8/4k3/8/8/4K3/4P3/8 w - - 12 47
+ **************************************/
+void TestFen::read_noCastle()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read("8/8/4k3/8/8/4K3/4P3/8 w - - 12 47");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(fen.type[4][5] == KING);
+   assertUnit(fen.fWhite[4][5] == false);
+   assertUnit(fen.type[4][2] == KING);
+   assertUnit(fen.fWhite[4][2] == true);
+   assertUnit(fen.castle == 0);
+   assertUnit(fen.halfMoves == 12);
+   assertUnit(fen.fullMoves == 47);
+}  // TEARDOWN
+
+/*************************************
+ * READ : EPD has operations instead of counters
+ * Input:  ... w KQkq - bm e4;
+ * Output: counters keep their defaults
+ **************************************/
+void TestFen::read_epd()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read(
+      "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - bm e4;");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(fen.halfMoves == 0);
+   assertUnit(fen.fullMoves == 1);
+}  // TEARDOWN
+
+/*************************************
+ * READ : a rank with nine squares
+ * Output: false, the Fen is cleared
+ **************************************/
+void TestFen::read_badRank()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read(
+      "rnbqkbnr/ppppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   // VERIFY
+   assertUnit(success == false);
+   assertUnit(fen.type[0][0] == SPACE);
+}  // TEARDOWN
+
+/*************************************
+ * READ : nine ranks
+ * Output: false
+ **************************************/
+void TestFen::read_tooManyRanks()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read("8/8/8/8/8/8/8/8/8 w - - 0 1");
+   // VERIFY
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : side to move is not w or b
+ * Output: false
+ **************************************/
+void TestFen::read_badSide()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read("8/8/8/8/8/8/8/8 x - - 0 1");
+   // VERIFY
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : en passant square on the fourth rank
+ * Output: false
+ **************************************/
+void TestFen::read_badEnPassant()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read("8/8/8/8/8/8/8/8 w - e4 0 1");
+   // VERIFY
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : en passant square on the wrong side's rank
+ * Input:  white to move with e3, black to move with e6
+ * Output: false for both
+ **************************************/
+void TestFen::read_enPassantWrongSide()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool white = fen.read("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e3 0 1");
+   bool black = fen.read("rnbqkbnr/pppp1ppp/8/4p3/8/8/PPPPPPPP/RNBQKBNR b KQkq e6 0 1");
+   // VERIFY
+   assertUnit(white == false);
+   assertUnit(black == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : the largest counters still fit
+ **************************************/
+void TestFen::read_counterLimit()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool success = fen.read("8/8/8/8/8/8/8/8 w - - 99999 99999");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(fen.getHalfMoves() == Fen::MAX_COUNTER);
+   assertUnit(fen.getFullMoves() == Fen::MAX_COUNTER);
+}  // TEARDOWN
+
+/*************************************
+ * READ : a counter too large for an int is rejected
+ **************************************/
+void TestFen::read_counterOverflow()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   bool halfTooBig = fen.read("8/8/8/8/8/8/8/8 w - - 99999999999 1");
+   bool fullTooBig = fen.read("8/8/8/8/8/8/8/8 w - - 0 100000");
+   // VERIFY
+   assertUnit(halfTooBig == false);
+   assertUnit(fullTooBig == false);
+   assertUnit(fen.getHalfMoves() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * WRITE : the starting position
+ **************************************/
+void TestFen::write_start()
+{  // SETUP
+   Fen fen;
+   fen.read(START);
+   char buffer[Fen::MAX_LENGTH];
+   // EXERCISE
+   int length = fen.write(buffer);
+   // VERIFY
+   assertUnit(length == (int)strlen(START));
+   assertUnit(strcmp(buffer, START) == 0);
+}  // TEARDOWN
+
+/*************************************
+ * WRITE : an empty board
+ **************************************/
+void TestFen::write_empty()
+{  // SETUP
+   Fen fen;
+   // EXERCISE
+   std::string text = fen.getText();
+   // VERIFY
+   assertUnit(text == "8/8/8/8/8/8/8/8 w - - 0 1");
+}  // TEARDOWN
+
+/*************************************
+ * WRITE : read then write gives the same text
+ **************************************/
+void TestFen::write_roundTrip()
+{  // SETUP
+   const char* text =
+      "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b Kq a3 3 21";
+   Fen fen;
+   fen.read(text);
+   // EXERCISE
+   std::string result = fen.getText();
+   // VERIFY
+   assertUnit(result == text);
+}  // TEARDOWN
+
+/*************************************
+ * GET CURRENT MOVE : white on move 3
+ * Output: 4, same as Board::numMoves
+ **************************************/
+void TestFen::getCurrentMove_white()
+{  // SETUP
+   Fen fen;
+   fen.read("8/8/8/8/8/8/8/8 w - - 0 3");
+   // EXERCISE
+   int currentMove = fen.getCurrentMove();
+   // VERIFY
+   assertUnit(currentMove == 4);
+}  // TEARDOWN
+
+/*************************************
+ * GET CURRENT MOVE : black on move 3
+ * Output: 5, an odd number is black's turn
+ **************************************/
+void TestFen::getCurrentMove_black()
+{  // SETUP
+   Fen fen;
+   fen.read("8/8/8/8/8/8/8/8 b - - 0 3");
+   // EXERCISE
+   int currentMove = fen.getCurrentMove();
+   // VERIFY
+   assertUnit(currentMove == 5);
+}  // TEARDOWN
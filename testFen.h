@@ -0,0 +1,61 @@
+/***********************************************************************
+ * Header File:
+ *    TEST FEN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for reading and writing FEN
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * FEN TEST
+ * Test the Fen class
+ ***************************************************/
+class TestFen : public UnitTest
+{
+public:
+   void run()
+   {
+      construct_default();
+      read_start();
+      read_enPassant();
+      read_noCastle();
+      read_epd();
+      read_badRank();
+      read_tooManyRanks();
+      read_badSide();
+      read_badEnPassant();
+      read_enPassantWrongSide();
+      read_counterLimit();
+      read_counterOverflow();
+      write_start();
+      write_empty();
+      write_roundTrip();
+      getCurrentMove_white();
+      getCurrentMove_black();
+
+      report("Fen");
+   }
+private:
+   void construct_default();
+   void read_start();
+   void read_enPassant();
+   void read_noCastle();
+   void read_epd();
+   void read_badRank();
+   void read_tooManyRanks();
+   void read_badSide();
+   void read_badEnPassant();
+   void read_enPassantWrongSide();
+   void read_counterLimit();
+   void read_counterOverflow();
+   void write_start();
+   void write_empty();
+   void write_roundTrip();
+   void getCurrentMove_white();
+   void getCurrentMove_black();
+};
@@ -0,0 +1,235 @@
+/***********************************************************************
+ * Source File:
+ *    TEST GAME RECORD
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the binary game format
+ ************************************************************************/
+
+#include "testGameRecord.h"
+#include "gameRecord.h"
+#include "board.h"
+#include <sstream>
+#include <vector>
+using namespace std;
+
+/***************************************************
+ * BOARD SPY
+ * Remember every move handed to the board
+ ***************************************************/
+class BoardSpy : public Board
+{
+public:
+   void move(const Move& move) { moves.push_back(move); Board::move(move); }
+   vector<Move> moves;
+};
+
+/***********************************************
+ * MOVES FROM TEXT
+ ***********************************************/
+static vector<Move> movesFromText(const vector<const char*>& texts)
+{
+   vector<Move> moves;
+   for (auto text : texts)
+   {
+      Move move;
+      move.readFromString(text);
+      moves.push_back(move);
+   }
+   return moves;
+}
+
+/*************************************
+ * ENCODE : simple move round trip
+ * Input:  e2e4
+ * Output: two bytes, same move back
+ **************************************/
+void TestGameRecord::encode_simple()
+{  // SETUP
+   Move move;
+   move.readFromString("e2e4");
+   // EXERCISE
+   uint16_t code = GameRecord::encode(move);
+   Move result = GameRecord::decode(code);
+   // VERIFY
+   assertUnit(code == (12 | (28 << 6)));
+   assertUnit(result == move);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : castling round trip
+ * Input:  e8c8C
+ **************************************/
+void TestGameRecord::encode_castle()
+{  // SETUP
+   Move move;
+   move.readFromString("e8c8C");
+   // EXERCISE
+   Move result = GameRecord::decode(GameRecord::encode(move));
+   // VERIFY
+   assertUnit(result.getMoveType() == Move::CASTLE_QUEEN);
+   assertUnit(result == move);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : en passant round trip
+ * Input:  e5d6E
+ **************************************/
+void TestGameRecord::encode_enPassant()
+{  // SETUP
+   Move move;
+   move.readFromString("e5d6E");
+   // EXERCISE
+   Move result = GameRecord::decode(GameRecord::encode(move));
+   // VERIFY
+   assertUnit(result.getMoveType() == Move::ENPASSANT);
+   assertUnit(result == move);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : promotion round trip
+ * Input:  b7b8 promoting to a bishop
+ **************************************/
+void TestGameRecord::encode_promote()
+{  // SETUP
+   Move move;
+   move.readFromString("b7b8b");
+   // EXERCISE
+   Move result = GameRecord::decode(GameRecord::encode(move));
+   // VERIFY
+   assertUnit(result.getPromote() == BISHOP);
+   assertUnit(result.getDest() == Position("b8"));
+   assertUnit(result == move);
+}  // TEARDOWN
+
+/*************************************
+ * READ : not a game record file
+ **************************************/
+void TestGameRecord::read_badHeader()
+{  // SETUP
+   const char data[] = "PGN!\x01\x00\x00\x0c\x07";
+   // EXERCISE
+   GameRecord record(data, data + sizeof(data) - 1);
+   // VERIFY
+   assertUnit(record.isValid() == false);
+   assertUnit(record.next() == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : write two games and read them back
+ **************************************/
+void TestGameRecord::read_twoGames()
+{  // SETUP
+   vector<Move> game1 = movesFromText({ "e2e4", "e7e5", "g1f3" });
+   vector<Move> game2 = movesFromText({ "d2d4" });
+   ostringstream out;
+   GameRecord::writeHeader(out);
+   GameRecord::write(out, game1.data(), (int)game1.size(), GameRecord::WHITE_WINS);
+   GameRecord::write(out, game2.data(), (int)game2.size(), GameRecord::DRAW);
+   string data = out.str();
+   // EXERCISE
+   GameRecord record(data.data(), data.data() + data.size());
+   bool first = record.next();
+   int numMoves1 = record.getNumMoves();
+   GameRecord::Result result1 = record.getResult();
+   Move move1 = record.getMove(2);
+   bool second = record.next();
+   // VERIFY
+   assertUnit(data.size() == 4 + (3 + 6) + (3 + 2));
+   assertUnit(record.isValid() == true);
+   assertUnit(first == true);
+   assertUnit(numMoves1 == 3);
+   assertUnit(result1 == GameRecord::WHITE_WINS);
+   assertUnit(move1 == game1[2]);
+   assertUnit(second == true);
+   assertUnit(record.getNumMoves() == 1);
+   assertUnit(record.getResult() == GameRecord::DRAW);
+   assertUnit(record.getMove(0) == game2[0]);
+   assertUnit(record.next() == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : a game with no moves
+ **************************************/
+void TestGameRecord::read_empty()
+{  // SETUP
+   ostringstream out;
+   GameRecord::writeHeader(out);
+   GameRecord::write(out, nullptr, 0, GameRecord::BLACK_WINS);
+   string data = out.str();
+   // EXERCISE
+   GameRecord record(data.data(), data.data() + data.size());
+   bool found = record.next();
+   // VERIFY
+   assertUnit(found == true);
+   assertUnit(record.getNumMoves() == 0);
+   assertUnit(record.getResult() == GameRecord::BLACK_WINS);
+   assertUnit(record.next() == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : the last game is cut short
+ **************************************/
+void TestGameRecord::read_truncated()
+{  // SETUP
+   vector<Move> game = movesFromText({ "e2e4", "e7e5" });
+   ostringstream out;
+   GameRecord::writeHeader(out);
+   GameRecord::write(out, game.data(), (int)game.size(), GameRecord::DRAW);
+   string data = out.str();
+   // EXERCISE
+   GameRecord record(data.data(), data.data() + data.size() - 1);
+   bool found = record.next();
+   // VERIFY
+   assertUnit(found == false);
+   assertUnit(record.getNumMoves() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * READ : a result byte past DRAW is a damaged file,
+ *        so neither game is read
+ **************************************/
+void TestGameRecord::read_badResult()
+{  // SETUP
+   vector<Move> game = movesFromText({ "e2e4", "e7e5" });
+   ostringstream out;
+   GameRecord::writeHeader(out);
+   GameRecord::write(out, game.data(), (int)game.size(), GameRecord::DRAW);
+   GameRecord::write(out, game.data(), (int)game.size(), GameRecord::DRAW);
+   string data = out.str();
+   data[GameRecord::HEADER_SIZE + 2] = 7;
+   // EXERCISE
+   GameRecord record(data.data(), data.data() + data.size());
+   bool first = record.next();
+   bool second = record.next();
+   // VERIFY
+   assertUnit(first == false);
+   assertUnit(second == false);
+   assertUnit(record.getNumMoves() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * REPLAY : every move goes through Board::move
+ **************************************/
+void TestGameRecord::replay_board()
+{  // SETUP
+   vector<Move> game = movesFromText({ "e2e4", "e7e5", "e1g1c" });
+   ostringstream out;
+   GameRecord::writeHeader(out);
+   GameRecord::write(out, game.data(), (int)game.size(), GameRecord::DRAW);
+   string data = out.str();
+   GameRecord record(data.data(), data.data() + data.size());
+   record.next();
+   BoardSpy board;
+   // EXERCISE
+   record.replay(board);
+   // VERIFY
+   assertUnit(board.getCurrentMove() == 3);
+   assertUnit(board.moves.size() == 3);
+   if (board.moves.size() == 3)
+   {
+      assertUnit(board.moves[0] == game[0]);
+      assertUnit(board.moves[2] == game[2]);
+   }
+}  // TEARDOWN
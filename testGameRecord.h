@@ -0,0 +1,47 @@
+/***********************************************************************
+ * Header File:
+ *    TEST GAME RECORD
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the binary game format
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * GAME RECORD TEST
+ * Test the GameRecord class
+ ***************************************************/
+class TestGameRecord : public UnitTest
+{
+public:
+   void run()
+   {
+      encode_simple();
+      encode_castle();
+      encode_enPassant();
+      encode_promote();
+      read_badHeader();
+      read_twoGames();
+      read_empty();
+      read_truncated();
+      read_badResult();
+      replay_board();
+
+      report("GameRecord");
+   }
+private:
+   void encode_simple();
+   void encode_castle();
+   void encode_enPassant();
+   void encode_promote();
+   void read_badHeader();
+   void read_twoGames();
+   void read_empty();
+   void read_truncated();
+   void read_badResult();
+   void replay_board();
+};
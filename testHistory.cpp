@@ -0,0 +1,235 @@
+/***********************************************************************
+ * Source File:
+ *    TEST HISTORY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for repetition and fifty move detection
+ ************************************************************************/
+
+#include "testHistory.h"
+#include "history.h"
+
+/*************************************
+ * CONSTRUCTOR : the getters work before reset()
+ **************************************/
+void TestHistory::construct_default()
+{  // SETUP
+   // EXERCISE
+   History history;
+   // VERIFY
+   assertUnit(history.numPlies == 1);
+   assertUnit(history.getHalfMoves() == 0);
+   assertUnit(history.isFiftyMoves() == false);
+   assertUnit(history.isRepetition() == false);
+}  // TEARDOWN
+
+/*************************************
+ * RESET : start of a game
+ **************************************/
+void TestHistory::reset_start()
+{  // SETUP
+   History history;
+   // EXERCISE
+   history.reset(0xA);
+   // VERIFY
+   assertUnit(history.numPlies == 1);
+   assertUnit(history.keys[0] == 0xA);
+   assertUnit(history.getHalfMoves() == 0);
+   assertUnit(history.isRepetition() == false);
+}  // TEARDOWN
+
+/*************************************
+ * RESET : the clock carries over from a FEN
+ **************************************/
+void TestHistory::reset_fromFen()
+{  // SETUP
+   History history;
+   // EXERCISE
+   history.reset(0xA, 37);
+   // VERIFY
+   assertUnit(history.getHalfMoves() == 37);
+}  // TEARDOWN
+
+/*************************************
+ * PUSH : a knight move adds to the clock
+ **************************************/
+void TestHistory::push_reversible()
+{  // SETUP
+   History history;
+   history.reset(0xA, 5);
+   // EXERCISE
+   history.push(0xB, false);
+   // VERIFY
+   assertUnit(history.numPlies == 2);
+   assertUnit(history.getHalfMoves() == 6);
+}  // TEARDOWN
+
+/*************************************
+ * PUSH : a pawn move resets the clock
+ **************************************/
+void TestHistory::push_irreversible()
+{  // SETUP
+   History history;
+   history.reset(0xA, 5);
+   // EXERCISE
+   history.push(0xB, true);
+   // VERIFY
+   assertUnit(history.getHalfMoves() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * POP : the clock comes back with the move
+ **************************************/
+void TestHistory::pop_restoresClock()
+{  // SETUP
+   History history;
+   history.reset(0xA, 5);
+   history.push(0xB, false);
+   history.push(0xC, true);
+   // EXERCISE
+   history.pop();
+   // VERIFY
+   assertUnit(history.numPlies == 2);
+   assertUnit(history.getHalfMoves() == 6);
+}  // TEARDOWN
+
+/*************************************
+ * REPETITION : four different positions
+ **************************************/
+void TestHistory::repetition_none()
+{  // SETUP
+   History history;
+   history.reset(0xA);
+   history.push(0xB, false);
+   history.push(0xC, false);
+   history.push(0xD, false);
+   // EXERCISE
+   history.push(0xE, false);
+   // VERIFY
+   assertUnit(history.getRepetitions() == 0);
+   assertUnit(history.isRepetition() == false);
+}  // TEARDOWN
+
+/*************************************
+ * REPETITION : Nf3 Nf6 Ng1 Ng8
+ * Output: the start position is back once
+ **************************************/
+void TestHistory::repetition_twice()
+{  // SETUP
+   History history;
+   history.reset(0xA);
+   history.push(0xB, false);
+   history.push(0xC, false);
+   history.push(0xD, false);
+   // EXERCISE
+   history.push(0xA, false);
+   // VERIFY
+   assertUnit(history.getRepetitions() == 1);
+   assertUnit(history.isRepetition() == true);
+   assertUnit(history.isThreefold() == false);
+}  // TEARDOWN
+
+/*************************************
+ * REPETITION : the knight dance twice
+ * Output: threefold repetition
+ **************************************/
+void TestHistory::repetition_threefold()
+{  // SETUP
+   History history;
+   history.reset(0xA);
+   for (int i = 0; i < 2; i++)
+   {
+      history.push(0xB, false);
+      history.push(0xC, false);
+      history.push(0xD, false);
+      history.push(0xA, false);
+   }
+   // EXERCISE
+   bool threefold = history.isThreefold();
+   // VERIFY
+   assertUnit(history.getRepetitions() == 2);
+   assertUnit(threefold == true);
+}  // TEARDOWN
+
+/*************************************
+ * REPETITION : a capture in between
+ * Output: positions before it do not count
+ **************************************/
+void TestHistory::repetition_afterCapture()
+{  // SETUP
+   History history;
+   history.reset(0xA);
+   history.push(0xB, false);
+   history.push(0xC, true);
+   history.push(0xD, false);
+   // EXERCISE
+   history.push(0xA, false);
+   // VERIFY
+   assertUnit(history.isRepetition() == false);
+}  // TEARDOWN
+
+/*************************************
+ * REPETITION : only entries with the same side
+ *              to move are compared
+ * Output: the same key three plies back is not a repeat
+ **************************************/
+void TestHistory::repetition_otherSide()
+{  // SETUP
+   History history;
+   history.reset(0xA);
+   history.push(0xB, false);
+   history.push(0xC, false);
+   // EXERCISE
+   history.push(0xA, false);
+   // VERIFY
+   assertUnit(history.getRepetitions() == 0);
+}  // TEARDOWN
+
+/*************************************
+ * FIFTY MOVES : 99 plies
+ **************************************/
+void TestHistory::fiftyMoves_notYet()
+{  // SETUP
+   History history;
+   history.reset(0, 98);
+   // EXERCISE
+   history.push(1, false);
+   // VERIFY
+   assertUnit(history.getHalfMoves() == 99);
+   assertUnit(history.isFiftyMoves() == false);
+}  // TEARDOWN
+
+/*************************************
+ * FIFTY MOVES : 100 plies
+ **************************************/
+void TestHistory::fiftyMoves_reached()
+{  // SETUP
+   History history;
+   history.reset(0, 99);
+   // EXERCISE
+   history.push(1, false);
+   // VERIFY
+   assertUnit(history.isFiftyMoves() == true);
+}  // TEARDOWN
+
+/*************************************
+ * RING : a game longer than the ring
+ * Output: recent repetitions are still found
+ **************************************/
+void TestHistory::ring_wraps()
+{  // SETUP
+   History history;
+   history.reset(0);
+   for (int i = 1; i < History::MAX_PLIES + 10; i++)
+      history.push((uint64_t)i, true);
+   history.push(0xB, false);
+   history.push(0xC, false);
+   history.push(0xD, false);
+   history.push(0xE, false);
+   // EXERCISE
+   history.push(0xB, false);
+   // VERIFY
+   assertUnit(history.isRepetition() == true);
+   assertUnit(history.getHalfMoves() == 5);
+}  // TEARDOWN
@@ -0,0 +1,55 @@
+/***********************************************************************
+ * Header File:
+ *    TEST HISTORY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for repetition and fifty move detection
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * HISTORY TEST
+ * Test the History class
+ ***************************************************/
+class TestHistory : public UnitTest
+{
+public:
+   void run()
+   {
+      construct_default();
+      reset_start();
+      reset_fromFen();
+      push_reversible();
+      push_irreversible();
+      pop_restoresClock();
+      repetition_none();
+      repetition_twice();
+      repetition_threefold();
+      repetition_afterCapture();
+      repetition_otherSide();
+      fiftyMoves_notYet();
+      fiftyMoves_reached();
+      ring_wraps();
+
+      report("History");
+   }
+private:
+   void construct_default();
+   void reset_start();
+   void reset_fromFen();
+   void push_reversible();
+   void push_irreversible();
+   void pop_restoresClock();
+   void repetition_none();
+   void repetition_twice();
+   void repetition_threefold();
+   void repetition_afterCapture();
+   void repetition_otherSide();
+   void fiftyMoves_notYet();
+   void fiftyMoves_reached();
+   void ring_wraps();
+};
@@ -0,0 +1,263 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PACKED POSITION
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for packed positions and their file format
+ ************************************************************************/
+
+#include "testPackedPosition.h"
+#include "packedPosition.h"
+#include <sstream>
+#include <string>
+using namespace std;
+
+static const char* START =
+   "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+static const char* KIWIPETE =
+   "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1";
+static const char* GAME[] =
+{
+   "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+   "rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1",
+   "rnbqkbnr/pppp1ppp/8/4p3/4P3/8/PPPP1PPP/RNBQKBNR w KQkq e6 0 2",
+   "rnbqkbnr/pppp1ppp/8/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R b KQkq - 1 2",
+   "r1bqkbnr/pppp1ppp/2n5/4p3/4P3/5N2/PPPP1PPP/RNBQKB1R w KQkq - 2 3",
+};
+
+/*************************************
+ * ENCODE : the starting position
+ * Output: ranks 1, 2, 7 and 8 occupied, white rook first
+ **************************************/
+void TestPackedPosition::encode_start()
+{  // SETUP
+   Fen fen;
+   fen.read(START);
+   PackedPosition packed;
+   // EXERCISE
+   bool success = packed.encode(fen);
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(packed.bytes[0] == 0xFF);
+   assertUnit(packed.bytes[1] == 0xFF);
+   assertUnit(packed.bytes[2] == 0x00);
+   assertUnit(packed.bytes[6] == 0xFF);
+   assertUnit(packed.bytes[7] == 0xFF);
+   assertUnit((packed.bytes[8] & 0x0F) == ROOK);
+   assertUnit((packed.bytes[8] >> 4) == KNIGHT);
+   assertUnit((packed.bytes[23] >> 4) == (ROOK | 8));
+   assertUnit(packed.bytes[24] == 0x1E);
+   assertUnit(packed.bytes[25] == 0);
+   assertUnit(packed.bytes[27] == 1);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : encode then decode a middlegame
+ **************************************/
+void TestPackedPosition::encode_roundTrip()
+{  // SETUP
+   Fen fen;
+   fen.read("r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R b Kq a3 3 301");
+   PackedPosition packed;
+   Fen result;
+   // EXERCISE
+   packed.encode(fen);
+   packed.decode(result);
+   // VERIFY
+   assertUnit(result.getText() == fen.getText());
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : the en passant rank comes from the side to move
+ **************************************/
+void TestPackedPosition::encode_enPassantBlack()
+{  // SETUP
+   Fen fen;
+   fen.read(GAME[2]);
+   PackedPosition packed;
+   Fen result;
+   // EXERCISE
+   packed.encode(fen);
+   packed.decode(result);
+   // VERIFY
+   assertUnit(result.getEnPassant() == Position("e6"));
+   assertUnit(result.getText() == GAME[2]);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : 33 pieces do not fit
+ **************************************/
+void TestPackedPosition::encode_tooManyPieces()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/pppppppp/8/8/8/7P/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   PackedPosition packed;
+   // EXERCISE
+   bool success = packed.encode(fen);
+   // VERIFY
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : the fullmove number needs more than 16 bits
+ **************************************/
+void TestPackedPosition::encode_fullMovesTooBig()
+{  // SETUP
+   Fen fen;
+   fen.read("8/8/8/4k3/8/8/8/4K3 w - - 0 70000");
+   PackedPosition packed;
+   // EXERCISE
+   bool success = packed.encode(fen);
+   // VERIFY
+   assertUnit(fen.getFullMoves() == 70000);
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * ENCODE : an en passant square decode() could not rebuild
+ **************************************/
+void TestPackedPosition::encode_enPassantWrongRank()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+   fen.setWhiteTurn(true);
+   PackedPosition packed;
+   // EXERCISE
+   bool success = packed.encode(fen);
+   // VERIFY
+   assertUnit(success == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : not a packed position file
+ **************************************/
+void TestPackedPosition::read_badHeader()
+{  // SETUP
+   const char data[] = "XXXX\x01\x00\x00\x00\x01\x00\x00\x00\x9f";
+   PackedPosition packed;
+   // EXERCISE
+   PackedReader reader(data, data + sizeof(data) - 1);
+   // VERIFY
+   assertUnit(reader.isValid() == false);
+   assertUnit(reader.next(packed) == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : a short game in one block
+ **************************************/
+void TestPackedPosition::read_roundTrip()
+{  // SETUP
+   ostringstream out;
+   {
+      PackedWriter writer(out);
+      for (auto text : GAME)
+      {
+         Fen fen;
+         fen.read(text);
+         PackedPosition packed;
+         packed.encode(fen);
+         writer.write(packed);
+      }
+   }
+   string data = out.str();
+   PackedReader reader(data.data(), data.data() + data.size());
+   PackedPosition packed;
+   Fen fen;
+   // EXERCISE
+   // VERIFY
+   assertUnit(reader.isValid() == true);
+   for (auto text : GAME)
+   {
+      assertUnit(reader.next(packed) == true);
+      packed.decode(fen);
+      assertUnit(fen.getText() == text);
+   }
+   assertUnit(reader.next(packed) == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : two records per block, three blocks
+ **************************************/
+void TestPackedPosition::read_severalBlocks()
+{  // SETUP
+   ostringstream out;
+   {
+      PackedWriter writer(out, 2);
+      for (auto text : GAME)
+      {
+         Fen fen;
+         fen.read(text);
+         PackedPosition packed;
+         packed.encode(fen);
+         writer.write(packed);
+      }
+   }
+   string data = out.str();
+   PackedReader reader(data.data(), data.data() + data.size());
+   PackedPosition packed;
+   Fen fen;
+   int num = 0;
+   // EXERCISE
+   while (reader.next(packed))
+   {
+      packed.decode(fen);
+      if (fen.getText() == GAME[num])
+         num++;
+   }
+   // VERIFY
+   assertUnit(num == 5);
+}  // TEARDOWN
+
+/*************************************
+ * READ : the same position many times
+ * Output: far smaller than 32 bytes each
+ **************************************/
+void TestPackedPosition::read_compresses()
+{  // SETUP
+   Fen fen;
+   fen.read(KIWIPETE);
+   PackedPosition packed;
+   packed.encode(fen);
+   ostringstream out;
+   {
+      PackedWriter writer(out);
+      for (int i = 0; i < 1000; i++)
+         writer.write(packed);
+   }
+   string data = out.str();
+   PackedReader reader(data.data(), data.data() + data.size());
+   PackedPosition result;
+   int num = 0;
+   // EXERCISE
+   while (reader.next(result))
+      num++;
+   // VERIFY
+   assertUnit(num == 1000);
+   assertUnit(data.size() < 1000 * 2);
+   result.decode(fen);
+   assertUnit(fen.getText() == KIWIPETE);
+}  // TEARDOWN
+
+/*************************************
+ * READ : the block is cut short
+ **************************************/
+void TestPackedPosition::read_truncated()
+{  // SETUP
+   ostringstream out;
+   {
+      PackedWriter writer(out);
+      Fen fen;
+      fen.read(START);
+      PackedPosition packed;
+      packed.encode(fen);
+      writer.write(packed);
+   }
+   string data = out.str();
+   PackedReader reader(data.data(), data.data() + data.size() - 1);
+   PackedPosition packed;
+   // EXERCISE
+   bool found = reader.next(packed);
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
@@ -0,0 +1,49 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PACKED POSITION
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for packed positions and their file format
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PACKED POSITION TEST
+ * Test PackedPosition, PackedWriter and PackedReader
+ ***************************************************/
+class TestPackedPosition : public UnitTest
+{
+public:
+   void run()
+   {
+      encode_start();
+      encode_roundTrip();
+      encode_enPassantBlack();
+      encode_tooManyPieces();
+      encode_fullMovesTooBig();
+      encode_enPassantWrongRank();
+      read_badHeader();
+      read_roundTrip();
+      read_severalBlocks();
+      read_compresses();
+      read_truncated();
+
+      report("PackedPosition");
+   }
+private:
+   void encode_start();
+   void encode_roundTrip();
+   void encode_enPassantBlack();
+   void encode_tooManyPieces();
+   void encode_fullMovesTooBig();
+   void encode_enPassantWrongRank();
+   void read_badHeader();
+   void read_roundTrip();
+   void read_severalBlocks();
+   void read_compresses();
+   void read_truncated();
+};
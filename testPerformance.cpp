@@ -0,0 +1,183 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PERFORMANCE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Time budgets and heap use of the primitives
+ ************************************************************************/
+
+#include "testPerformance.h"
+#include "allocationCounter.h"
+#include "position.h"
+#include "move.h"
+#include "board.h"
+#include "piece.h"
+#include "fen.h"
+#include "san.h"
+#include <cstdint>
+#include <new>
+
+/***********************************************
+ * The budgets are about ten times what a release
+ * build measures, so only a real regression fails.
+ ***********************************************/
+
+/*************************************
+ * COUNTER : one new is one allocation.
+ *    Call operator new directly; a new expression whose
+ *    result is never used may be optimized away
+ **************************************/
+void TestPerformance::counter_counts()
+{  // SETUP
+   AllocationCounter counter;
+   // EXERCISE
+   void* p = ::operator new(sizeof(int));
+   void* a = ::operator new[](7 * sizeof(int));
+   // VERIFY
+   assertUnit(counter.getCount() == 2);
+   // TEARDOWN
+   ::operator delete[](a);
+   ::operator delete(p);
+}
+
+/*************************************
+ * COUNTER : each counter starts at its own zero
+ **************************************/
+void TestPerformance::counter_nested()
+{  // SETUP
+   AllocationCounter outer;
+   void* p1 = ::operator new(sizeof(int));
+   // EXERCISE
+   AllocationCounter inner;
+   void* p2 = ::operator new(sizeof(int));
+   long long countOuter = outer.getCount();
+   long long countInner = inner.getCount();
+   // VERIFY
+   assertUnit(countOuter == 2);
+   assertUnit(countInner == 1);
+   // TEARDOWN
+   ::operator delete(p2);
+   ::operator delete(p1);
+}
+
+/*************************************
+ * COUNTER : over-aligned allocations count too
+ **************************************/
+void TestPerformance::counter_aligned()
+{  // SETUP
+   AllocationCounter counter;
+   // EXERCISE
+   void* p = ::operator new(100, std::align_val_t(64));
+   long long count = counter.getCount();
+   // VERIFY
+   assertUnit(count == 1);
+   assertUnit(((std::uintptr_t)p & 63) == 0);
+   // TEARDOWN
+   ::operator delete(p, std::align_val_t(64));
+}
+
+/*************************************
+ * POSITION : construction, arithmetic and parsing stay off the heap
+ **************************************/
+void TestPerformance::position_noAllocations()
+{  // SETUP
+   Position pos;
+   // EXERCISE / VERIFY
+   assertNoAllocations(pos = Position(3, 4));
+   assertNoAllocations(pos += ADD_R);
+   assertNoAllocations(pos = "e4");
+}  // TEARDOWN
+
+/*************************************
+ * POSITION : a few nanoseconds each
+ **************************************/
+void TestPerformance::position_fast()
+{  // SETUP
+   Position pos;
+   int i = 0;
+   // EXERCISE / VERIFY
+   assertFaster((i = (i + 1) & 63, Position(i & 7, i >> 3).getLocation()), 100.0);
+   assertFaster((pos = "e4").getCol(), 100.0);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE : short text fits in the string without the heap
+ **************************************/
+void TestPerformance::move_readNoAllocations()
+{  // SETUP
+   Move move;
+   std::string text("e5d6E");
+   // EXERCISE / VERIFY
+   assertNoAllocations(move.readFromString(text));
+}  // TEARDOWN
+
+/*************************************
+ * MOVE : read from a string
+ **************************************/
+void TestPerformance::move_readFast()
+{  // SETUP
+   Move move;
+   std::string text("e1g1c");
+   // EXERCISE / VERIFY
+   assertFaster((move.readFromString(text), move.getMoveType()), 300.0);
+}  // TEARDOWN
+
+/*************************************
+ * MOVE : get text
+ **************************************/
+void TestPerformance::move_getTextFast()
+{  // SETUP
+   Move move;
+   move.readFromString("e5d6r");
+   // EXERCISE / VERIFY
+   assertFaster(move.getText().size(), 6000.0);
+}  // TEARDOWN
+
+/*************************************
+ * BOARD : looking up a square and moving stay off the heap
+ **************************************/
+void TestPerformance::board_noAllocations()
+{  // SETUP
+   Board board;
+   const Board& boardConst = board;
+   Move move;
+   Position pos(3, 4);
+   // EXERCISE / VERIFY
+   assertNoAllocations(boardConst[pos]);
+   assertNoAllocations(board.move(move));
+}  // TEARDOWN
+
+/*************************************
+ * BOARD : looking up a square and moving
+ **************************************/
+void TestPerformance::board_fast()
+{  // SETUP
+   Board board;
+   const Board& boardConst = board;
+   Move move;
+   Position pos(3, 4);
+   // EXERCISE / VERIFY
+   assertFaster(boardConst[pos].fWhite, 100.0);
+   assertFaster((board.move(move), board.getCurrentMove()), 100.0);
+}  // TEARDOWN
+
+/*************************************
+ * FEN : reading parses in place
+ **************************************/
+void TestPerformance::fen_readNoAllocations()
+{  // SETUP
+   Fen fen;
+   // EXERCISE / VERIFY
+   assertNoAllocations(fen.read("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1"));
+}  // TEARDOWN
+
+/*************************************
+ * SAN : reading parses in place
+ **************************************/
+void TestPerformance::san_readNoAllocations()
+{  // SETUP
+   San san;
+   // EXERCISE / VERIFY
+   assertNoAllocations(san.read("exd6 e.p."));
+}  // TEARDOWN
@@ -0,0 +1,52 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PERFORMANCE
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    Time budgets and heap use of the primitives
+ ************************************************************************/
+
+#pragma once
+
+#include "perfTest.h"
+
+/***************************************************
+ * PERFORMANCE TEST
+ * Fail the run when a primitive becomes much slower
+ * or starts to allocate
+ ***************************************************/
+class TestPerformance : public PerfTest
+{
+public:
+   void run()
+   {
+      counter_counts();
+      counter_nested();
+      counter_aligned();
+      position_noAllocations();
+      position_fast();
+      move_readNoAllocations();
+      move_readFast();
+      move_getTextFast();
+      board_noAllocations();
+      board_fast();
+      fen_readNoAllocations();
+      san_readNoAllocations();
+
+      report("Performance");
+   }
+private:
+   void counter_counts();
+   void counter_nested();
+   void counter_aligned();
+   void position_noAllocations();
+   void position_fast();
+   void move_readNoAllocations();
+   void move_readFast();
+   void move_getTextFast();
+   void board_noAllocations();
+   void board_fast();
+   void fen_readNoAllocations();
+   void san_readNoAllocations();
+};
@@ -0,0 +1,348 @@
+/***********************************************************************
+ * Source File:
+ *    TEST PGN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the PGN reader
+ ************************************************************************/
+
+#include "testPgn.h"
+#include "pgn.h"
+#include "mappedFile.h"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+using namespace std;
+
+static const char* TWO_GAMES =
+   "[Event \"Casual\"]\n"
+   "[White \"Morphy, Paul\"]\n"
+   "[Black \"Duke \\\"Karl\\\"\"]\n"
+   "[Result \"1-0\"]\n"
+   "\n"
+   "1. e4 e5 2. Nf3 d6 1-0\n"
+   "\n"
+   "[Event \"Second\"]\n"
+   "[Result \"1/2-1/2\"]\n"
+   "\n"
+   "1. d4 d5 1/2-1/2\n";
+
+/*************************************
+ * NEXT : the tags of the first game
+ **************************************/
+void TestPgn::next_tags()
+{  // SETUP
+   Pgn pgn(TWO_GAMES, TWO_GAMES + strlen(TWO_GAMES));
+   Pgn::Game game;
+   // EXERCISE
+   bool found = pgn.next(game);
+   // VERIFY
+   assertUnit(found == true);
+   assertUnit(game.numTags == 4);
+   assertUnit(game.tags[0].name == "Event");
+   assertUnit(game.tags[0].value == "Casual");
+   assertUnit(game.getTag("White") == "Morphy, Paul");
+   assertUnit(game.getTag("Black") == "Duke \\\"Karl\\\"");
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : the movetext of the first game
+ **************************************/
+void TestPgn::next_movetext()
+{  // SETUP
+   Pgn pgn(TWO_GAMES, TWO_GAMES + strlen(TWO_GAMES));
+   Pgn::Game game;
+   // EXERCISE
+   pgn.next(game);
+   // VERIFY
+   assertUnit(game.movetext == "1. e4 e5 2. Nf3 d6 1-0");
+   assertUnit(game.result == "1-0");
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : both games, then nothing
+ **************************************/
+void TestPgn::next_twoGames()
+{  // SETUP
+   Pgn pgn(TWO_GAMES, TWO_GAMES + strlen(TWO_GAMES));
+   Pgn::Game game;
+   // EXERCISE
+   bool first = pgn.next(game);
+   bool second = pgn.next(game);
+   string_view event = game.getTag("Event");
+   string_view movetext = game.movetext;
+   bool third = pgn.next(game);
+   // VERIFY
+   assertUnit(first == true);
+   assertUnit(second == true);
+   assertUnit(event == "Second");
+   assertUnit(movetext == "1. d4 d5 1/2-1/2");
+   assertUnit(third == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : only white space
+ **************************************/
+void TestPgn::next_empty()
+{  // SETUP
+   const char* text = "\n\n  \n";
+   Pgn pgn(text, text + strlen(text));
+   Pgn::Game game;
+   // EXERCISE
+   bool found = pgn.next(game);
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : a game missing its result runs
+ *        up to the next tag section
+ **************************************/
+void TestPgn::next_noResult()
+{  // SETUP
+   const char* text =
+      "[Event \"A\"]\n\n1. e4 e5\n\n[Event \"B\"]\n\n1. c4 *\n";
+   Pgn pgn(text, text + strlen(text));
+   Pgn::Game game;
+   // EXERCISE
+   pgn.next(game);
+   string_view movetext = game.movetext;
+   string_view result = game.result;
+   pgn.next(game);
+   // VERIFY
+   assertUnit(movetext == "1. e4 e5");
+   assertUnit(result.empty());
+   assertUnit(game.getTag("Event") == "B");
+   assertUnit(game.result == "*");
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : a comment and a NAG before the first game
+ *        are skipped, not taken for the end
+ **************************************/
+void TestPgn::next_leadingComment()
+{  // SETUP
+   const char* text =
+      "{Generated by X}\n$1\n\n[Event \"A\"]\n\n1. e4 e5 1-0\n\n"
+      "[Event \"B\"]\n\n1. d4 d5 0-1\n";
+   Pgn pgn(text, text + strlen(text));
+   Pgn::Game game;
+   // EXERCISE
+   bool first = pgn.next(game);
+   string_view eventFirst = game.getTag("Event");
+   bool second = pgn.next(game);
+   string_view eventSecond = game.getTag("Event");
+   bool third = pgn.next(game);
+   // VERIFY
+   assertUnit(first == true);
+   assertUnit(eventFirst == "A");
+   assertUnit(second == true);
+   assertUnit(eventSecond == "B");
+   assertUnit(third == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT : nothing but a comment is no game
+ **************************************/
+void TestPgn::next_onlyComment()
+{  // SETUP
+   const char* text = "{just a note}\n$2\n";
+   Pgn pgn(text, text + strlen(text));
+   Pgn::Game game;
+   // EXERCISE
+   bool found = pgn.next(game);
+   // VERIFY
+   assertUnit(found == false);
+}  // TEARDOWN
+
+/*************************************
+ * GET TAG : a tag that is not there
+ **************************************/
+void TestPgn::getTag_missing()
+{  // SETUP
+   Pgn pgn(TWO_GAMES, TWO_GAMES + strlen(TWO_GAMES));
+   Pgn::Game game;
+   pgn.next(game);
+   // EXERCISE
+   string_view value = game.getTag("ECO");
+   // VERIFY
+   assertUnit(value.empty());
+}  // TEARDOWN
+
+/*************************************
+ * NEXT MOVE : move numbers are skipped
+ * Input:  1. e4 e5 2. Nf3 Nc6 1-0
+ * Output: e4 e5 Nf3 Nc6
+ **************************************/
+void TestPgn::nextMove_simple()
+{  // SETUP
+   string_view movetext = "1. e4 e5 2. Nf3 Nc6 1-0";
+   string_view san[5];
+   bool found[5];
+   // EXERCISE
+   for (int i = 0; i < 5; i++)
+      found[i] = Pgn::nextMove(movetext, san[i]);
+   // VERIFY
+   assertUnit(found[0] && san[0] == "e4");
+   assertUnit(found[1] && san[1] == "e5");
+   assertUnit(found[2] && san[2] == "Nf3");
+   assertUnit(found[3] && san[3] == "Nc6");
+   assertUnit(found[4] == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT MOVE : brace and line comments, NAGs
+ * Input:  1. e4 {best by test} e5 $1 ; rest of line
+ *         2. Nf3 *
+ * Output: e4 e5 Nf3
+ **************************************/
+void TestPgn::nextMove_comments()
+{  // SETUP
+   string_view movetext =
+      "1. e4 {best by test} e5 $1 ; rest of line e6\n2. Nf3 *";
+   string_view san[4];
+   bool found[4];
+   // EXERCISE
+   for (int i = 0; i < 4; i++)
+      found[i] = Pgn::nextMove(movetext, san[i]);
+   // VERIFY
+   assertUnit(found[0] && san[0] == "e4");
+   assertUnit(found[1] && san[1] == "e5");
+   assertUnit(found[2] && san[2] == "Nf3");
+   assertUnit(found[3] == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT MOVE : nested variations are skipped
+ * Input:  1. e4 (1. d4 d5 (1... Nf6 {a (paren}) 2. c4) 1... c5 0-1
+ * Output: e4 c5
+ **************************************/
+void TestPgn::nextMove_variations()
+{  // SETUP
+   string_view movetext =
+      "1. e4 (1. d4 d5 (1... Nf6 {a (paren}) 2. c4) 1... c5 0-1";
+   string_view san[3];
+   bool found[3];
+   // EXERCISE
+   for (int i = 0; i < 3; i++)
+      found[i] = Pgn::nextMove(movetext, san[i]);
+   // VERIFY
+   assertUnit(found[0] && san[0] == "e4");
+   assertUnit(found[1] && san[1] == "c5");
+   assertUnit(found[2] == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT MOVE : check marks stay, annotations go
+ * Input:  e4!? Qh5+ Qxf7#!!
+ * Output: e4 Qh5+ Qxf7#
+ **************************************/
+void TestPgn::nextMove_annotations()
+{  // SETUP
+   string_view movetext = "e4!? Qh5+ Qxf7#!!";
+   string_view san[4];
+   bool found[4];
+   // EXERCISE
+   for (int i = 0; i < 4; i++)
+      found[i] = Pgn::nextMove(movetext, san[i]);
+   // VERIFY
+   assertUnit(found[0] && san[0] == "e4");
+   assertUnit(found[1] && san[1] == "Qh5+");
+   assertUnit(found[2] && san[2] == "Qxf7#");
+   assertUnit(found[3] == false);
+}  // TEARDOWN
+
+/*************************************
+ * NEXT MOVE : numbers without a space
+ * Input:  1.e4 e5 2.O-O 2...O-O-O
+ * Output: e4 e5 O-O O-O-O
+ **************************************/
+void TestPgn::nextMove_gluedNumbers()
+{  // SETUP
+   string_view movetext = "1.e4 e5 2.O-O 2...O-O-O";
+   string_view san[5];
+   bool found[5];
+   // EXERCISE
+   for (int i = 0; i < 5; i++)
+      found[i] = Pgn::nextMove(movetext, san[i]);
+   // VERIFY
+   assertUnit(found[0] && san[0] == "e4");
+   assertUnit(found[1] && san[1] == "e5");
+   assertUnit(found[2] && san[2] == "O-O");
+   assertUnit(found[3] && san[3] == "O-O-O");
+   assertUnit(found[4] == false);
+}  // TEARDOWN
+
+/*************************************
+ * SPLIT : two chunks, one game each
+ **************************************/
+void TestPgn::split_two()
+{  // SETUP
+   const char* end = TWO_GAMES + strlen(TWO_GAMES);
+   Pgn::Game game;
+   // EXERCISE
+   vector<Pgn> chunks = Pgn::split(TWO_GAMES, end, 2);
+   // VERIFY
+   assertUnit(chunks.size() == 2);
+   if (chunks.size() == 2)
+   {
+      assertUnit(chunks[0].next(game) == true);
+      assertUnit(game.getTag("Event") == "Casual");
+      assertUnit(chunks[0].next(game) == false);
+      assertUnit(chunks[1].next(game) == true);
+      assertUnit(game.getTag("Event") == "Second");
+      assertUnit(chunks[1].next(game) == false);
+   }
+}  // TEARDOWN
+
+/*************************************
+ * SPLIT : more threads than games
+ * Output: no chunk is empty
+ **************************************/
+void TestPgn::split_moreChunksThanGames()
+{  // SETUP
+   const char* end = TWO_GAMES + strlen(TWO_GAMES);
+   Pgn::Game game;
+   int numGames = 0;
+   // EXERCISE
+   vector<Pgn> chunks = Pgn::split(TWO_GAMES, end, 16);
+   // VERIFY
+   assertUnit(chunks.size() <= 2);
+   for (auto& chunk : chunks)
+   {
+      assertUnit(chunk.next(game) == true);
+      numGames++;
+      while (chunk.next(game))
+         numGames++;
+   }
+   assertUnit(numGames == 2);
+}  // TEARDOWN
+
+/*************************************
+ * SPLIT : straight from a mapped file
+ **************************************/
+void TestPgn::split_mappedFile()
+{  // SETUP
+   const char* filename = "testPgn.pgn";
+   {
+      ofstream fout(filename, ios::binary);
+      for (int i = 0; i < 50; i++)
+         fout << TWO_GAMES << "\n";
+   }
+   MappedFile file;
+   file.open(filename);
+   Pgn::Game game;
+   int numGames = 0;
+   // EXERCISE
+   vector<Pgn> chunks = Pgn::split(file.data(), file.data() + file.size(), 4);
+   for (auto& chunk : chunks)
+      while (chunk.next(game))
+         numGames++;
+   // VERIFY
+   assertUnit(chunks.size() == 4);
+   assertUnit(numGames == 100);
+   // TEARDOWN
+   file.close();
+   remove(filename);
+}
@@ -0,0 +1,59 @@
+/***********************************************************************
+ * Header File:
+ *    TEST PGN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the PGN reader
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * PGN TEST
+ * Test the Pgn class
+ ***************************************************/
+class TestPgn : public UnitTest
+{
+public:
+   void run()
+   {
+      next_tags();
+      next_movetext();
+      next_twoGames();
+      next_empty();
+      next_noResult();
+      next_leadingComment();
+      next_onlyComment();
+      getTag_missing();
+      nextMove_simple();
+      nextMove_comments();
+      nextMove_variations();
+      nextMove_annotations();
+      nextMove_gluedNumbers();
+      split_two();
+      split_moreChunksThanGames();
+      split_mappedFile();
+
+      report("Pgn");
+   }
+private:
+   void next_tags();
+   void next_movetext();
+   void next_twoGames();
+   void next_empty();
+   void next_noResult();
+   void next_leadingComment();
+   void next_onlyComment();
+   void getTag_missing();
+   void nextMove_simple();
+   void nextMove_comments();
+   void nextMove_variations();
+   void nextMove_annotations();
+   void nextMove_gluedNumbers();
+   void split_two();
+   void split_moreChunksThanGames();
+   void split_mappedFile();
+};
@@ -0,0 +1,147 @@
+/***********************************************************************
+ * Source File:
+ *    TEST POLYGLOT KEY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the Polyglot key against the published values
+ ************************************************************************/
+
+#include "testPolyglotKey.h"
+#include "polyglotKey.h"
+#include "fen.h"
+
+/*************************************
+ * KEY : the starting position
+ * Input:  rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1
+ * Output: 0x463b96181691fc9c
+ **************************************/
+void TestPolyglotKey::key_start()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x463b96181691fc9cULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : 1.e4: no black pawn can take on e3
+ * Input:  rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1
+ * Output: 0x823c9b50fd114196
+ **************************************/
+void TestPolyglotKey::key_e4()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/pppppppp/8/8/4P3/8/PPPP1PPP/RNBQKBNR b KQkq e3 0 1");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x823c9b50fd114196ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : 1.e4 d5: no white pawn can take on d6
+ * Input:  rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2
+ * Output: 0x0756b94461c50fb0
+ **************************************/
+void TestPolyglotKey::key_e4d5()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/ppp1pppp/8/3p4/4P3/8/PPPP1PPP/RNBQKBNR w KQkq d6 0 2");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x0756b94461c50fb0ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : 1.e4 d5 2.e5
+ * Input:  rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2
+ * Output: 0x662fafb965db29d4
+ **************************************/
+void TestPolyglotKey::key_e4d5e5()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/ppp1pppp/8/3pP3/8/8/PPPP1PPP/RNBQKBNR b KQkq - 0 2");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x662fafb965db29d4ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : 1.e4 d5 2.e5 f5: exf6 is possible, so the file counts
+ * Input:  rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3
+ * Output: 0x22a48b5a8e47ff78
+ **************************************/
+void TestPolyglotKey::key_e4d5e5f5()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPP1PPP/RNBQKBNR w KQkq f6 0 3");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x22a48b5a8e47ff78ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : ... 3.Ke2: white loses castling
+ * Input:  rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR b kq - 0 3
+ * Output: 0x652a607ca3f242c1
+ **************************************/
+void TestPolyglotKey::key_e4d5e5f5Ke2()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/ppp1p1pp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR b kq - 0 3");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x652a607ca3f242c1ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : ... 3...Kf7: no castling at all
+ * Input:  rnbq1bnr/ppp1pkpp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR w - - 0 4
+ * Output: 0x00fdd303c946bdd9
+ **************************************/
+void TestPolyglotKey::key_e4d5e5f5Ke2Kf7()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbq1bnr/ppp1pkpp/8/3pPp2/8/8/PPPPKPPP/RNBQ1BNR w - - 0 4");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x00fdd303c946bdd9ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : 1.a4 b5 2.h4 b4 3.c4: bxc3 is possible
+ * Input:  rnbqkbnr/p1pppppp/8/8/PpP4P/8/1P1PPPP1/RNBQKBNR b KQkq c3 0 3
+ * Output: 0x3c8123ea7b067637
+ **************************************/
+void TestPolyglotKey::key_a4b5h4b4c4()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/p1pppppp/8/8/PpP4P/8/1P1PPPP1/RNBQKBNR b KQkq c3 0 3");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x3c8123ea7b067637ULL);
+}  // TEARDOWN
+
+/*************************************
+ * KEY : ... 3...bxc3 4.Ra3
+ * Input:  rnbqkbnr/p1pppppp/8/8/P6P/R1p5/1P1PPPP1/1NBQKBNR b Kkq - 0 4
+ * Output: 0x5c3f9b829b279560
+ **************************************/
+void TestPolyglotKey::key_a4b5h4b4c4bxc3Ra3()
+{  // SETUP
+   Fen fen;
+   fen.read("rnbqkbnr/p1pppppp/8/8/P6P/R1p5/1P1PPPP1/1NBQKBNR b Kkq - 0 4");
+   // EXERCISE
+   uint64_t key = polyglotKey(fen);
+   // VERIFY
+   assertUnit(key == 0x5c3f9b829b279560ULL);
+}  // TEARDOWN
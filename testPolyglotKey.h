@@ -0,0 +1,45 @@
+/***********************************************************************
+ * Header File:
+ *    TEST POLYGLOT KEY
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for the Polyglot key against the published values
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * POLYGLOT KEY TEST
+ * Test polyglotKey()
+ ***************************************************/
+class TestPolyglotKey : public UnitTest
+{
+public:
+   void run()
+   {
+      key_start();
+      key_e4();
+      key_e4d5();
+      key_e4d5e5();
+      key_e4d5e5f5();
+      key_e4d5e5f5Ke2();
+      key_e4d5e5f5Ke2Kf7();
+      key_a4b5h4b4c4();
+      key_a4b5h4b4c4bxc3Ra3();
+
+      report("PolyglotKey");
+   }
+private:
+   void key_start();
+   void key_e4();
+   void key_e4d5();
+   void key_e4d5e5();
+   void key_e4d5e5f5();
+   void key_e4d5e5f5Ke2();
+   void key_e4d5e5f5Ke2Kf7();
+   void key_a4b5h4b4c4();
+   void key_a4b5h4b4c4bxc3Ra3();
+};
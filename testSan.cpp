@@ -0,0 +1,364 @@
+/***********************************************************************
+ * Source File:
+ *    TEST SAN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for standard algebraic notation
+ ************************************************************************/
+
+#include "testSan.h"
+#include "san.h"
+
+/*************************************
+ * READ : pawn push
+ * Input:  e4
+ **************************************/
+void TestSan::read_pawnPush()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("e4");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == PAWN);
+   assertUnit(san.dest == Position("e4"));
+   assertUnit(san.fromCol == -1);
+   assertUnit(san.fromRow == -1);
+   assertUnit(san.fCapture == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : piece move
+ * Input:  Nf3
+ **************************************/
+void TestSan::read_piece()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("Nf3");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == KNIGHT);
+   assertUnit(san.dest == Position("f3"));
+   assertUnit(san.moveType == Move::MOVE);
+}  // TEARDOWN
+
+/*************************************
+ * READ : file disambiguation
+ * Input:  Nbd7
+ **************************************/
+void TestSan::read_disambiguateFile()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("Nbd7");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == KNIGHT);
+   assertUnit(san.fromCol == 1);
+   assertUnit(san.fromRow == -1);
+   assertUnit(san.dest == Position("d7"));
+}  // TEARDOWN
+
+/*************************************
+ * READ : rank disambiguation with capture
+ * Input:  R1xa3
+ **************************************/
+void TestSan::read_disambiguateRank()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("R1xa3");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == ROOK);
+   assertUnit(san.fromCol == -1);
+   assertUnit(san.fromRow == 0);
+   assertUnit(san.fCapture == true);
+   assertUnit(san.dest == Position("a3"));
+}  // TEARDOWN
+
+/*************************************
+ * READ : full square disambiguation
+ * Input:  Qh4e1
+ **************************************/
+void TestSan::read_disambiguateBoth()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("Qh4e1");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == QUEEN);
+   assertUnit(san.fromCol == 7);
+   assertUnit(san.fromRow == 3);
+   assertUnit(san.dest == Position("e1"));
+}  // TEARDOWN
+
+/*************************************
+ * READ : en passant written out
+ * Input:  exd6 e.p.
+ **************************************/
+void TestSan::read_enPassant()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("exd6 e.p.");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == PAWN);
+   assertUnit(san.fromCol == 4);
+   assertUnit(san.fCapture == true);
+   assertUnit(san.dest == Position("d6"));
+   assertUnit(san.moveType == Move::ENPASSANT);
+}  // TEARDOWN
+
+/*************************************
+ * READ : king side castle with a zero
+ * Input:  0-0+
+ **************************************/
+void TestSan::read_castleKing()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("0-0+");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == KING);
+   assertUnit(san.moveType == Move::CASTLE_KING);
+   assertUnit(san.fCheck == true);
+}  // TEARDOWN
+
+/*************************************
+ * READ : queen side castle
+ * Input:  O-O-O
+ **************************************/
+void TestSan::read_castleQueen()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("O-O-O");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.moveType == Move::CASTLE_QUEEN);
+   assertUnit(san.fCheck == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : promotion with check
+ * Input:  e8=Q+
+ **************************************/
+void TestSan::read_promoteCheck()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("e8=Q+");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.piece == PAWN);
+   assertUnit(san.dest == Position("e8"));
+   assertUnit(san.promote == QUEEN);
+   assertUnit(san.fCheck == true);
+   assertUnit(san.fMate == false);
+}  // TEARDOWN
+
+/*************************************
+ * READ : capture promotion with mate, no '='
+ * Input:  bxa8N#
+ **************************************/
+void TestSan::read_promoteNoEquals()
+{  // SETUP
+   San san;
+   // EXERCISE
+   bool success = san.read("bxa8N#");
+   // VERIFY
+   assertUnit(success == true);
+   assertUnit(san.fromCol == 1);
+   assertUnit(san.fCapture == true);
+   assertUnit(san.dest == Position("a8"));
+   assertUnit(san.promote == KNIGHT);
+   assertUnit(san.fMate == true);
+}  // TEARDOWN
+
+/*************************************
+ * READ : not moves
+ * Input:  e9, Zf3, Nf3=Q, exd, e4 e.p.
+ **************************************/
+void TestSan::read_invalid()
+{  // SETUP
+   San san;
+   // EXERCISE
+   // VERIFY
+   assertUnit(san.read("e9") == false);
+   assertUnit(san.read("Zf3") == false);
+   assertUnit(san.read("Nf3=Q") == false);
+   assertUnit(san.read("exd") == false);
+   assertUnit(san.read("e4 e.p.") == false);
+   assertUnit(san.read("") == false);
+   assertUnit(san.piece == INVALID);
+}  // TEARDOWN
+
+/*************************************
+ * WRITE : pawn capture
+ * Output: exd5
+ **************************************/
+void TestSan::write_pawnCapture()
+{  // SETUP
+   San san;
+   san.read("exd5");
+   // EXERCISE
+   std::string text = san.getText();
+   // VERIFY
+   assertUnit(text == "exd5");
+}  // TEARDOWN
+
+/*************************************
+ * WRITE : castle with mate
+ * Output: O-O-O#
+ **************************************/
+void TestSan::write_castleMate()
+{  // SETUP
+   San san;
+   san.read("0-0-0#");
+   // EXERCISE
+   std::string text = san.getText();
+   // VERIFY
+   assertUnit(text == "O-O-O#");
+}  // TEARDOWN
+
+/*************************************
+ * FROM MOVE : nothing else can reach the square
+ * Input:  g1f3, knight, no rivals
+ * Output: Nf3
+ **************************************/
+void TestSan::fromMove_noRivals()
+{  // SETUP
+   Move move;
+   move.readFromString("g1f3");
+   // EXERCISE
+   San san = San::fromMove(move, KNIGHT, nullptr, 0);
+   // VERIFY
+   assertUnit(san.getText() == "Nf3");
+}  // TEARDOWN
+
+/*************************************
+ * FROM MOVE : a rival on another file
+ * Input:  b8d7, knight, rival on f6
+ * Output: Nbd7
+ **************************************/
+void TestSan::fromMove_rivalOtherFile()
+{  // SETUP
+   Move move;
+   move.readFromString("b8d7");
+   Position rivals[] = { Position("f6") };
+   // EXERCISE
+   San san = San::fromMove(move, KNIGHT, rivals, 1);
+   // VERIFY
+   assertUnit(san.getText() == "Nbd7");
+}  // TEARDOWN
+
+/*************************************
+ * FROM MOVE : a rival on the same file
+ * Input:  a1a3 capturing a rook, rook, rival on a5
+ * Output: R1xa3
+ **************************************/
+void TestSan::fromMove_rivalSameFile()
+{  // SETUP
+   Move move;
+   move.readFromString("a1a3r");
+   Position rivals[] = { Position("a5") };
+   // EXERCISE
+   San san = San::fromMove(move, ROOK, rivals, 1, true /*check*/);
+   // VERIFY
+   assertUnit(san.getText() == "R1xa3+");
+}  // TEARDOWN
+
+/*************************************
+ * FROM MOVE : rivals on the same file and the same rank
+ * Input:  h4e1, queen, rivals on h1 and e4
+ * Output: Qh4e1
+ **************************************/
+void TestSan::fromMove_rivalsBoth()
+{  // SETUP
+   Move move;
+   move.readFromString("h4e1");
+   Position rivals[] = { Position("h1"), Position("e4") };
+   // EXERCISE
+   San san = San::fromMove(move, QUEEN, rivals, 2);
+   // VERIFY
+   assertUnit(san.getText() == "Qh4e1");
+}  // TEARDOWN
+
+/*************************************
+ * FROM MOVE : en passant shows as a plain capture
+ * Input:  e5d6E
+ * Output: exd6
+ **************************************/
+void TestSan::fromMove_enPassant()
+{  // SETUP
+   Move move;
+   move.readFromString("e5d6E");
+   // EXERCISE
+   San san = San::fromMove(move, PAWN, nullptr, 0);
+   // VERIFY
+   assertUnit(san.getText() == "exd6");
+}  // TEARDOWN
+
+/*************************************
+ * MATCHES : only the right piece
+ * Input:  Nf3 against g1f3 by a knight and by a bishop
+ **************************************/
+void TestSan::matches_piece()
+{  // SETUP
+   San san;
+   san.read("Nf3");
+   Move move;
+   move.readFromString("g1f3");
+   // EXERCISE
+   bool knight = san.matches(move, KNIGHT);
+   bool bishop = san.matches(move, BISHOP);
+   // VERIFY
+   assertUnit(knight == true);
+   assertUnit(bishop == false);
+}  // TEARDOWN
+
+/*************************************
+ * MATCHES : the file picks one of two knights
+ * Input:  Nbd7 against b8d7 and f6d7
+ **************************************/
+void TestSan::matches_disambiguation()
+{  // SETUP
+   San san;
+   san.read("Nbd7");
+   Move moveB;
+   moveB.readFromString("b8d7");
+   Move moveF;
+   moveF.readFromString("f6d7");
+   // EXERCISE
+   bool b = san.matches(moveB, KNIGHT);
+   bool f = san.matches(moveF, KNIGHT);
+   // VERIFY
+   assertUnit(b == true);
+   assertUnit(f == false);
+}  // TEARDOWN
+
+/*************************************
+ * MATCHES : castling is matched by type
+ * Input:  O-O against e1g1c and e1c1C
+ **************************************/
+void TestSan::matches_castle()
+{  // SETUP
+   San san;
+   san.read("O-O");
+   Move moveKing;
+   moveKing.readFromString("e1g1c");
+   Move moveQueen;
+   moveQueen.readFromString("e1c1C");
+   // EXERCISE
+   bool king = san.matches(moveKing, KING);
+   bool queen = san.matches(moveQueen, KING);
+   // VERIFY
+   assertUnit(king == true);
+   assertUnit(queen == false);
+}  // TEARDOWN
@@ -0,0 +1,69 @@
+/***********************************************************************
+ * Header File:
+ *    TEST SAN
+ * Author:
+ *    Ethen Campbell & Joseph Gyman
+ * Summary:
+ *    The unit tests for standard algebraic notation
+ ************************************************************************/
+
+#pragma once
+
+#include "unitTest.h"
+
+/***************************************************
+ * SAN TEST
+ * Test the San class
+ ***************************************************/
+class TestSan : public UnitTest
+{
+public:
+   void run()
+   {
+      read_pawnPush();
+      read_piece();
+      read_disambiguateFile();
+      read_disambiguateRank();
+      read_disambiguateBoth();
+      read_enPassant();
+      read_castleKing();
+      read_castleQueen();
+      read_promoteCheck();
+      read_promoteNoEquals();
+      read_invalid();
+      write_pawnCapture();
+      write_castleMate();
+      fromMove_noRivals();
+      fromMove_rivalOtherFile();
+      fromMove_rivalSameFile();
+      fromMove_rivalsBoth();
+      fromMove_enPassant();
+      matches_piece();
+      matches_disambiguation();
+      matches_castle();
+
+      report("San");
+   }
+private:
+   void read_pawnPush();
+   void read_piece();
+   void read_disambiguateFile();
+   void read_disambiguateRank();
+   void read_disambiguateBoth();
+   void read_enPassant();
+   void read_castleKing();
+   void read_castleQueen();
+   void read_promoteCheck();
+   void read_promoteNoEquals();
+   void read_invalid();
+   void write_pawnCapture();
+   void write_castleMate();
+   void fromMove_noRivals();
+   void fromMove_rivalOtherFile();
+   void fromMove_rivalSameFile();
+   void fromMove_rivalsBoth();
+   void fromMove_enPassant();
+   void matches_piece();
+   void matches_disambiguation();
+   void matches_castle();
+};